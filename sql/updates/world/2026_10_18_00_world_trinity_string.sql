@@ -0,0 +1,3 @@
+DELETE FROM `trinity_string` WHERE `entry` IN (5035);
+INSERT INTO `trinity_string` (`entry`,`content_default`) VALUES
+(5035, 'Local chat messages dropped by rate limit: %u');
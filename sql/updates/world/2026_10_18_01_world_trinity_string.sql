@@ -0,0 +1,3 @@
+DELETE FROM `trinity_string` WHERE `entry` IN (5036);
+INSERT INTO `trinity_string` (`entry`,`content_default`) VALUES
+(5036, 'World state packets saved by batching: %u');
@@ -0,0 +1,3 @@
+DELETE FROM `trinity_string` WHERE `entry` IN (5037);
+INSERT INTO `trinity_string` (`entry`,`content_default`) VALUES
+(5037, 'Movement relays: %u sent in %u packets (%.1f packets/s, %.1f bytes/s)');
@@ -0,0 +1,4 @@
+DELETE FROM `trinity_string` WHERE `entry` IN (5038,5039);
+INSERT INTO `trinity_string` (`entry`,`content_default`) VALUES
+(5038, 'Dead creatures unloaded until respawn: %u (about %u KB), respawned from the queue: %u'),
+(5039, 'Respawn times written: %u in %u transactions');
@@ -0,0 +1,4 @@
+DELETE FROM `trinity_string` WHERE `entry` IN (5040,5041);
+INSERT INTO `trinity_string` (`entry`,`content_default`) VALUES
+(5040, 'Creature updates skipped while idle: %.0f of %.0f'),
+(5041, 'Creature updates in the last map update: %u, skipped idle: %u');
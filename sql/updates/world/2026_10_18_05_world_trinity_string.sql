@@ -0,0 +1,5 @@
+DELETE FROM `trinity_string` WHERE `entry` IN (5042,5043,5044);
+INSERT INTO `trinity_string` (`entry`,`content_default`) VALUES
+(5042, 'Loaded grids: %u, grid memory: %u KB (terrain %u KB, vmap models %u KB), limit: %u MB'),
+(5043, 'Grid [%u, %u] %s (active %u s ago): %u creatures, %u gameobjects, %u players, %u others, objects %u KB, terrain %u KB, vmap %u KB'),
+(5044, 'Map %u instance %u: %u grids, objects %u KB, terrain %u KB, vmap %u KB');
@@ -0,0 +1,5 @@
+DELETE FROM `trinity_string` WHERE `entry` IN (5045,5046,5047);
+INSERT INTO `trinity_string` (`entry`,`content_default`) VALUES
+(5045, 'Heap: %u KB allocated, %u KB active, %u KB mapped'),
+(5046, 'Heap statistics are not available (not running on the bundled jemalloc)'),
+(5047, 'Pool of %u byte blocks: %u live, %u free, %.0f allocations (%.1f%% reused)');
@@ -0,0 +1,3 @@
+DELETE FROM `trinity_string` WHERE `entry` IN (5048);
+INSERT INTO `trinity_string` (`entry`,`content_default`) VALUES
+(5048, 'Visibility: %.0f objects created (%.1f/s), %.0f removed (%.1f/s), %.0f creations put off');
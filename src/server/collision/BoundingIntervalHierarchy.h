@@ -350,6 +350,8 @@ class BIH
         bool writeToFile(FILE* wf) const;
         bool readFromFile(FILE* rf);
 
+        size_t GetMemoryUsage() const { return (tree.capacity() + objects.capacity()) * sizeof(uint32); }
+
     protected:
         std::vector<uint32> tree;
         std::vector<uint32> objects;
@@ -94,6 +94,12 @@ namespace VMAP
             */
             virtual bool getAreaInfo(unsigned int pMapId, float x, float y, float &z, uint32 &flags, int32 &adtId, int32 &rootId, int32 &groupId) const=0;
             virtual bool GetLiquidLevel(uint32 pMapId, float x, float y, float z, uint8 ReqLiquidType, float &level, float &floor, uint32 &type) const=0;
+            /**
+            Memory accounting: bytes attributed to a loaded tile (models shared between tiles are counted for each of them)
+            and bytes of all loaded models (each model counted once)
+            */
+            virtual size_t getTileMemoryUsage(unsigned int pMapId, int x, int y) const=0;
+            virtual size_t getLoadedModelMemoryUsage() const=0;
     };
 
 }
@@ -35,7 +35,7 @@ using G3D::Vector3;
 
 namespace VMAP
 {
-    VMapManager2::VMapManager2()
+    VMapManager2::VMapManager2() : iLoadedModelMemory(0)
     {
     }
 
@@ -220,6 +220,14 @@ namespace VMAP
         return false;
     }
 
+    size_t VMapManager2::getTileMemoryUsage(unsigned int mapId, int x, int y) const
+    {
+        InstanceTreeMap::const_iterator instanceTree = iInstanceMapTrees.find(mapId);
+        if (instanceTree != iInstanceMapTrees.end())
+            return instanceTree->second->getTileMemoryUsage(x, y);
+        return 0;
+    }
+
     bool VMapManager2::GetLiquidLevel(uint32 mapId, float x, float y, float z, uint8 reqLiquidType, float& level, float& floor, uint32& type) const
     {
         if (IsVMAPDisabledForPtr(mapId, VMAP_DISABLE_LIQUIDSTATUS))
@@ -263,6 +271,7 @@ namespace VMAP
             VMAP_DEBUG_LOG(LOG_FILTER_MAPS, "VMapManager2: loading file '%s%s'", basepath.c_str(), filename.c_str());
             model = iLoadedModelFiles.insert(std::pair<std::string, ManagedModel>(filename, ManagedModel())).first;
             model->second.setModel(worldmodel);
+            iLoadedModelMemory += worldmodel->GetMemoryUsage();
         }
         model->second.incRefCount();
         return model->second.getModel();
@@ -282,6 +291,7 @@ namespace VMAP
         if (model->second.decRefCount() == 0)
         {
             VMAP_DEBUG_LOG(LOG_FILTER_MAPS, "VMapManager2: unloading file '%s'", filename.c_str());
+            iLoadedModelMemory -= model->second.getModel()->GetMemoryUsage();
             delete model->second.getModel();
             iLoadedModelFiles.erase(model);
         }
@@ -22,6 +22,7 @@
 #include "IVMapManager.h"
 #include "Define.h"
 #include <ace/Thread_Mutex.h>
+#include <atomic>
 #include <unordered_map>
 
 //===========================================================
@@ -74,6 +75,7 @@ namespace VMAP
             InstanceTreeMap iInstanceMapTrees;
             // Mutex for iLoadedModelFiles
             ACE_Thread_Mutex LoadedModelFilesLock;
+            std::atomic<size_t> iLoadedModelMemory;
 
             bool _loadMap(uint32 mapId, const std::string& basePath, uint32 tileX, uint32 tileY);
             /* void _unloadMap(uint32 pMapId, uint32 x, uint32 y); */
@@ -103,6 +105,9 @@ namespace VMAP
             bool getAreaInfo(unsigned int pMapId, float x, float y, float& z, uint32& flags, int32& adtId, int32& rootId, int32& groupId) const;
             bool GetLiquidLevel(uint32 pMapId, float x, float y, float z, uint8 reqLiquidType, float& level, float& floor, uint32& type) const;
 
+            size_t getTileMemoryUsage(unsigned int mapId, int x, int y) const;
+            size_t getLoadedModelMemoryUsage() const { return iLoadedModelMemory.load(); }
+
             WorldModel* acquireModelInstance(const std::string& basepath, const std::string& filename);
             void releaseModelInstance(const std::string& filename);
 
@@ -18,6 +18,7 @@
 
 #include "MapTree.h"
 #include "ModelInstance.h"
+#include "WorldModel.h"
 #include "VMapManager2.h"
 #include "VMapDefinitions.h"
 #include "Log.h"
@@ -383,6 +384,8 @@ namespace VMAP
                     WorldModel* model = vm->acquireModelInstance(iBasePath, spawn.name);
                     if (!model)
                         VMAP_ERROR_LOG("StaticMapTree::LoadMapTile() : could not acquire WorldModel pointer [%u, %u]", tileX, tileY);
+                    else
+                        iTileMemory[packTileID(tileX, tileY)] += sizeof(ModelInstance) + model->GetMemoryUsage();
 
                     // update tree
                     uint32 referencedVal;
@@ -479,6 +482,15 @@ namespace VMAP
             }
         }
         iLoadedTiles.erase(tile);
+        iTileMemory.erase(tileID);
+    }
+
+    //=========================================================
+
+    size_t StaticMapTree::getTileMemoryUsage(uint32 tileX, uint32 tileY) const
+    {
+        tileMemoryMap::const_iterator itr = iTileMemory.find(packTileID(tileX, tileY));
+        return itr != iTileMemory.end() ? itr->second : 0;
     }
 
 }
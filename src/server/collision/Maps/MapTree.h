@@ -41,6 +41,7 @@ namespace VMAP
     {
         typedef std::unordered_map<uint32, bool> loadedTileMap;
         typedef std::unordered_map<uint32, uint32> loadedSpawnMap;
+        typedef std::unordered_map<uint32, size_t> tileMemoryMap;
         private:
             uint32 iMapID;
             bool iIsTiled;
@@ -54,6 +55,8 @@ namespace VMAP
             loadedTileMap iLoadedTiles;
             // stores <tree_index, reference_count> to invalidate tree values, unload map, and to be able to report errors
             loadedSpawnMap iLoadedSpawns;
+            // bytes of the model spawns and the models referenced by each loaded tile, shared models counted for every tile
+            tileMemoryMap iTileMemory;
             std::string iBasePath;
 
         private:
@@ -80,6 +83,7 @@ namespace VMAP
             void UnloadMapTile(uint32 tileX, uint32 tileY, VMapManager2* vm);
             bool isTiled() const { return iIsTiled; }
             uint32 numLoadedTiles() const { return iLoadedTiles.size(); }
+            size_t getTileMemoryUsage(uint32 tileX, uint32 tileY) const;
     };
 
     struct AreaInfo
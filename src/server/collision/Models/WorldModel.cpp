@@ -203,6 +203,11 @@ namespace VMAP
                 iTilesX * iTilesY;
     }
 
+    size_t WmoLiquid::GetMemoryUsage() const
+    {
+        return sizeof(WmoLiquid) + (iTilesX + 1) * (iTilesY + 1) * sizeof(float) + iTilesX * iTilesY * sizeof(uint8);
+    }
+
     bool WmoLiquid::writeToFile(FILE* wf)
     {
         bool result = true;
@@ -397,6 +402,14 @@ namespace VMAP
         return 0;
     }
 
+    size_t GroupModel::GetMemoryUsage() const
+    {
+        size_t size = vertices.capacity() * sizeof(Vector3) + triangles.capacity() * sizeof(MeshTriangle) + meshTree.GetMemoryUsage();
+        if (iLiquid)
+            size += iLiquid->GetMemoryUsage();
+        return size;
+    }
+
     // ===================== WorldModel ==================================
 
     void WorldModel::setGroupModels(std::vector<GroupModel> &models)
@@ -570,4 +583,12 @@ namespace VMAP
         fclose(rf);
         return result;
     }
+
+    size_t WorldModel::GetMemoryUsage() const
+    {
+        size_t size = sizeof(WorldModel) + groupModels.capacity() * sizeof(GroupModel) + groupTree.GetMemoryUsage();
+        for (std::vector<GroupModel>::const_iterator itr = groupModels.begin(); itr != groupModels.end(); ++itr)
+            size += itr->GetMemoryUsage();
+        return size;
+    }
 }
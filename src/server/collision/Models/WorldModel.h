@@ -56,6 +56,7 @@ namespace VMAP
             float *GetHeightStorage() { return iHeight; }
             uint8 *GetFlagsStorage() { return iFlags; }
             uint32 GetFileSize();
+            size_t GetMemoryUsage() const;
             bool writeToFile(FILE* wf);
             static bool readFromFile(FILE* rf, WmoLiquid* &liquid);
         private:
@@ -90,6 +91,7 @@ namespace VMAP
             const G3D::AABox& GetBound() const { return iBound; }
             uint32 GetMogpFlags() const { return iMogpFlags; }
             uint32 GetWmoID() const { return iGroupWMOID; }
+            size_t GetMemoryUsage() const;
         protected:
             G3D::AABox iBound;
             uint32 iMogpFlags;// 0x8 outdor; 0x2000 indoor
@@ -113,6 +115,8 @@ namespace VMAP
             bool GetLocationInfo(const G3D::Vector3 &p, const G3D::Vector3 &down, float &dist, LocationInfo &info) const;
             bool writeFile(const std::string &filename);
             bool readFile(const std::string &filename);
+            //! bytes held by the geometry, liquids and trees of the model
+            size_t GetMemoryUsage() const;
         protected:
             uint32 RootWMOID;
             std::vector<GroupModel> groupModels;
@@ -464,6 +464,7 @@ void AchievementMgr::Reset()
 
     m_completedAchievements.clear();
     m_criteriaProgress.clear();
+    m_completedCriteria.clear();
     DeleteFromDB(m_player->GetGUIDLow());
 
     // re-fill data
@@ -796,10 +797,13 @@ void AchievementMgr::UpdateAchievementCriteria(AchievementCriteriaTypes type, ui
     if (m_player->isGameMaster())
         return;
 
-    AchievementCriteriaEntryList const& achievementCriteriaList = sAchievementMgr->GetAchievementCriteriaByType(type);
+    AchievementCriteriaEntryList const& achievementCriteriaList = sAchievementMgr->GetAchievementCriteriaByAsset(type, miscValue1);
     for (AchievementCriteriaEntryList::const_iterator i = achievementCriteriaList.begin(); i != achievementCriteriaList.end(); ++i)
     {
         AchievementCriteriaEntry const* achievementCriteria = (*i);
+        if (IsCriteriaCompletedCached(achievementCriteria->ID))
+            continue;
+
         AchievementEntry const* achievement = sAchievementStore.LookupEntry(achievementCriteria->referredAchievement);
         if (!achievement)
             continue;
@@ -1955,6 +1959,8 @@ void AchievementMgr::SetCriteriaProgress(AchievementCriteriaEntry const* entry,
         progress->counter = newValue;
     }
 
+    SetCriteriaCompletedCached(entry->ID, false);
+
     progress->changed = true;
     progress->date = time(NULL); // set the date to the latest update.
 
@@ -1987,6 +1993,7 @@ void AchievementMgr::RemoveCriteriaProgress(const AchievementCriteriaEntry* entr
     m_player->SendDirectMessage(&data);
 
     m_criteriaProgress.erase(criteriaProgress);
+    SetCriteriaCompletedCached(entry->ID, false);
 }
 
 void AchievementMgr::UpdateTimedAchievements(uint32 timeDiff)
@@ -2235,11 +2242,76 @@ bool AchievementMgr::CanUpdateCriteria(AchievementCriteriaEntry const* criteria,
 
     // don't update already completed criteria
     if (IsCompletedCriteria(criteria, achievement))
+    {
+        // realm first criteria stop being complete once someone else gets the achievement
+        if (!(achievement->flags & (ACHIEVEMENT_FLAG_REALM_FIRST_REACH | ACHIEVEMENT_FLAG_REALM_FIRST_KILL)))
+            SetCriteriaCompletedCached(criteria->ID, true);
         return false;
+    }
 
     return true;
 }
 
+void AchievementMgr::SetCriteriaCompletedCached(uint32 criteriaId, bool completed)
+{
+    if (criteriaId >= m_completedCriteria.size())
+    {
+        if (!completed)
+            return;
+        m_completedCriteria.resize(sAchievementCriteriaStore.GetNumRows(), false);
+    }
+
+    m_completedCriteria[criteriaId] = completed;
+}
+
+// types whose UpdateAchievementCriteria case skips every criteria with raw.field3 != miscValue1 when miscValue1 is set
+static bool IsCriteriaTypeKeyedByAsset(AchievementCriteriaTypes type)
+{
+    switch (type)
+    {
+        case ACHIEVEMENT_CRITERIA_TYPE_KILL_CREATURE:
+        case ACHIEVEMENT_CRITERIA_TYPE_REACH_SKILL_LEVEL:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LEVEL:
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUESTS_IN_ZONE:
+        case ACHIEVEMENT_CRITERIA_TYPE_KILLED_BY_CREATURE:
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUEST:
+        case ACHIEVEMENT_CRITERIA_TYPE_BE_SPELL_TARGET:
+        case ACHIEVEMENT_CRITERIA_TYPE_BE_SPELL_TARGET2:
+        case ACHIEVEMENT_CRITERIA_TYPE_CAST_SPELL:
+        case ACHIEVEMENT_CRITERIA_TYPE_CAST_SPELL2:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SPELL:
+        case ACHIEVEMENT_CRITERIA_TYPE_LOOT_TYPE:
+        case ACHIEVEMENT_CRITERIA_TYPE_OWN_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_USE_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_LOOT_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_GAIN_REPUTATION:
+        case ACHIEVEMENT_CRITERIA_TYPE_DO_EMOTE:
+        case ACHIEVEMENT_CRITERIA_TYPE_EQUIP_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_USE_GAMEOBJECT:
+        case ACHIEVEMENT_CRITERIA_TYPE_FISH_IN_GAMEOBJECT:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILLLINE_SPELLS:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LINE:
+        case ACHIEVEMENT_CRITERIA_TYPE_HK_CLASS:
+        case ACHIEVEMENT_CRITERIA_TYPE_HK_RACE:
+        case ACHIEVEMENT_CRITERIA_TYPE_BG_OBJECTIVE_CAPTURE:
+        case ACHIEVEMENT_CRITERIA_TYPE_HONORABLE_KILL_AT_AREA:
+            return true;
+        default:
+            return false;
+    }
+}
+
+AchievementCriteriaEntryList const& AchievementGlobalMgr::GetAchievementCriteriaByAsset(AchievementCriteriaTypes type, uint32 miscValue1) const
+{
+    // login and full refresh calls pass 0 and need every criteria of the type
+    if (!miscValue1 || !IsCriteriaTypeKeyedByAsset(type))
+        return m_AchievementCriteriasByType[type];
+
+    static AchievementCriteriaEntryList const emptyList;
+    AchievementCriteriaListByAsset::const_iterator itr = m_AchievementCriteriasByAsset[type].find(miscValue1);
+    return itr != m_AchievementCriteriasByAsset[type].end() ? itr->second : emptyList;
+}
+
 //==========================================================
 void AchievementGlobalMgr::LoadAchievementCriteriaList()
 {
@@ -2259,6 +2331,8 @@ void AchievementGlobalMgr::LoadAchievementCriteriaList()
             continue;
 
         m_AchievementCriteriasByType[criteria->requiredType].push_back(criteria);
+        if (IsCriteriaTypeKeyedByAsset(AchievementCriteriaTypes(criteria->requiredType)))
+            m_AchievementCriteriasByAsset[criteria->requiredType][criteria->raw.field3].push_back(criteria);
         m_AchievementCriteriaListByAchievement[criteria->referredAchievement].push_back(criteria);
 
         if (criteria->timeLimit)
@@ -32,6 +32,7 @@ typedef std::list<AchievementCriteriaEntry const*> AchievementCriteriaEntryList;
 typedef std::list<AchievementEntry const*>         AchievementEntryList;
 
 typedef std::map<uint32, AchievementCriteriaEntryList> AchievementCriteriaListByAchievement;
+typedef std::unordered_map<uint32, AchievementCriteriaEntryList> AchievementCriteriaListByAsset;
 typedef std::map<uint32, AchievementEntryList>         AchievementListByReferencedId;
 
 struct CriteriaProgress
@@ -281,11 +282,14 @@ class AchievementMgr
         bool IsCompletedCriteria(AchievementCriteriaEntry const* achievementCriteria, AchievementEntry const* achievement);
         bool IsCompletedAchievement(AchievementEntry const* entry);
         bool CanUpdateCriteria(AchievementCriteriaEntry const* criteria, AchievementEntry const* achievement);
+        bool IsCriteriaCompletedCached(uint32 criteriaId) const { return criteriaId < m_completedCriteria.size() && m_completedCriteria[criteriaId]; }
+        void SetCriteriaCompletedCached(uint32 criteriaId, bool completed);
         void BuildAllDataPacket(WorldPacket* data) const;
 
         Player* m_player;
         CriteriaProgressMap m_criteriaProgress;
         CompletedAchievementMap m_completedAchievements;
+        std::vector<bool> m_completedCriteria;        // indexed by criteria id, criteria known complete and skipped by UpdateAchievementCriteria
         typedef std::map<uint32, uint32> TimedAchievementMap;
         TimedAchievementMap m_timedAchievements;      // Criteria id/time left in MS
 };
@@ -302,6 +306,9 @@ class AchievementGlobalMgr
             return m_AchievementCriteriasByType[type];
         }
 
+        // criteria of the type that can match miscValue1, all of them if the type isn't keyed by its asset or miscValue1 is 0
+        AchievementCriteriaEntryList const& GetAchievementCriteriaByAsset(AchievementCriteriaTypes type, uint32 miscValue1) const;
+
         AchievementCriteriaEntryList const& GetTimedAchievementCriteriaByType(AchievementCriteriaTimedTypes type) const
         {
             return m_AchievementCriteriasByTimedType[type];
@@ -359,6 +366,8 @@ class AchievementGlobalMgr
         // store achievement criterias by type to speed up lookup
         AchievementCriteriaEntryList m_AchievementCriteriasByType[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
         AchievementCriteriaEntryList m_AchievementCriteriasByTimedType[ACHIEVEMENT_TIMED_TYPE_MAX];
+        // criteria of the types in IsCriteriaTypeKeyedByAsset() by their main requirement (raw.field3)
+        AchievementCriteriaListByAsset m_AchievementCriteriasByAsset[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
         // store achievement criterias by achievement to speed up lookup
         AchievementCriteriaListByAchievement m_AchievementCriteriaListByAchievement;
         // store achievements by referenced achievement id to speed up lookup
@@ -168,6 +168,7 @@ void AchievementMgr::ResetAddition()
 
     m_completedAchievements.clear();
     m_criteriaProgress.clear();
+    m_completedCriteria.clear();
     DeleteFromDB(m_player->GetGUIDLow());
 
     // re-fill data
@@ -221,6 +222,8 @@ void AchievementMgr::SetCriteriaProgressAddition(AchievementCriteriaEntry const*
         progress->counter = newValue;
     }
 
+    SetCriteriaCompletedCached(entry->ID, false);
+
     progress->changed = true;
     progress->date = time(NULL); // set the date to the latest update.
 
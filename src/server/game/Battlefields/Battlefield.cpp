@@ -37,6 +37,7 @@
 #include "CellImpl.h"
 #include "CreatureTextMgr.h"
 #include "GroupMgr.h"
+#include "World.h"
 
 
 Battlefield::Battlefield()
@@ -65,6 +66,7 @@ Battlefield::Battlefield()
     m_LastResurectTimer = 30 * IN_MILLISECONDS;
     m_StartGroupingTimer = 0;
     m_StartGrouping = false;
+    m_CoalescedWorldStates = 0;
 }
 
 Battlefield::~Battlefield()
@@ -625,10 +627,34 @@ void Battlefield::SendWarningToPlayer(Player* player, uint32 entry, uint32 addit
 
 void Battlefield::SendUpdateWorldState(uint32 field, uint32 value)
 {
+    std::pair<std::map<uint32, uint32>::iterator, bool> res = m_PendingWorldStates.insert(std::make_pair(field, value));
+    if (!res.second)
+    {
+        res.first->second = value;
+        ++m_CoalescedWorldStates;
+    }
+}
+
+void Battlefield::FlushWorldStates()
+{
+    if (m_PendingWorldStates.empty())
+        return;
+
+    uint32 recipients = 0;
     for (uint8 i = 0; i < BG_TEAMS_COUNT; ++i)
         for (GuidSet::iterator itr = m_players[i].begin(); itr != m_players[i].end(); ++itr)
             if (Player* pPlayer = sObjectAccessor->FindPlayer(*itr))
-                pPlayer->SendUpdateWorldState(field, value);
+            {
+                for (std::map<uint32, uint32>::const_iterator state = m_PendingWorldStates.begin(); state != m_PendingWorldStates.end(); ++state)
+                    pPlayer->SendUpdateWorldState(state->first, state->second);
+                ++recipients;
+            }
+
+    if (m_CoalescedWorldStates)
+        sWorld->IncreaseSavedWorldStatePacketCount(m_CoalescedWorldStates * recipients);
+
+    m_PendingWorldStates.clear();
+    m_CoalescedWorldStates = 0;
 }
 
 void Battlefield::RegisterZone(uint32 zoneId)
@@ -222,8 +222,10 @@ class Battlefield : public ZoneScript
         /// Call this to init the Battlefield
         virtual bool SetupBattlefield() { return true; }
 
-        /// Update data of a worldstate to all players present in zone
+        /// Update data of a worldstate to all players present in zone, sent by FlushWorldStates() at the end of the tick
         void SendUpdateWorldState(uint32 field, uint32 value);
+        /// Send the worldstates queued since the last call, one packet per field
+        void FlushWorldStates();
 
         /**
          * \brief Called every time for update bf data and time
@@ -392,6 +394,10 @@ class Battlefield : public ZoneScript
         /** Used for delayed invite to war because of taxi */
         GuidSet playersOnTaxi;
 
+        // Worldstates changed since the last FlushWorldStates(), last value wins
+        std::map<uint32, uint32> m_PendingWorldStates;
+        uint32 m_CoalescedWorldStates;
+
         // Variables that must exist for each battlefield
         uint32 m_TypeId; // See enum BattlefieldTypes
         uint32 m_BattleId; // BattleID (for packet)
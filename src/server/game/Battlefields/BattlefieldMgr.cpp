@@ -144,6 +144,9 @@ void BattlefieldMgr::Update(uint32 diff)
                 (*itr)->Update(m_UpdateTimer);
         m_UpdateTimer = 0;
     }
+
+    for (BattlefieldSet::iterator itr = m_BattlefieldSet.begin(); itr != m_BattlefieldSet.end(); ++itr)
+        (*itr)->FlushWorldStates();
 }
 
 ZoneScript* BattlefieldMgr::GetZoneScript(uint32 zoneId)
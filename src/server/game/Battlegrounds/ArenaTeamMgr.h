@@ -19,6 +19,7 @@
 #define _ARENATEAMMGR_H
 
 #include "ArenaTeam.h"
+#include <ace/Recursive_Thread_Mutex.h>
 
 class ArenaTeamMgr
 {
@@ -45,6 +46,8 @@ public:
     uint32 GenerateArenaTeamId();
     void SetNextArenaTeamId(uint32 Id) { NextArenaTeamId = Id; }
 
+    ACE_Recursive_Thread_Mutex ArenaTeamLock;               // rated arenas update team stats from their map threads
+
 protected:
     uint32 NextArenaTeamId;
     ArenaTeamContainer ArenaTeamStore;
@@ -155,6 +155,7 @@ Battleground::Battleground()
     m_LevelMax          = 0;
     m_InBGFreeSlotQueue = false;
     m_SetDeleteThis     = false;
+    m_StartAnnouncementPending = false;
 
     m_MaxPlayersPerTeam = 0;
     m_MaxPlayers        = 0;
@@ -195,6 +196,8 @@ Battleground::Battleground()
 
     m_PrematureCountDown = false;
 
+    m_CoalescedWorldStates = 0;
+
     m_HonorMode = BG_NORMAL;
 
     StartDelayTimes[BG_STARTING_EVENT_FIRST]  = BG_START_DELAY_2M;
@@ -548,7 +551,7 @@ inline void Battleground::_ProcessJoin(uint32 diff)
                 }
             // Announce BG starting
             if (sWorld->getBoolConfig(CONFIG_BATTLEGROUND_QUEUE_ANNOUNCER_ENABLE))
-                sWorld->SendWorldText(LANG_BG_STARTED_ANNOUNCE_WORLD, GetName(), GetMinLevel(), GetMaxLevel());
+                m_StartAnnouncementPending = true;
         }
     }
 
@@ -733,9 +736,32 @@ void Battleground::RewardReputationToTeam(uint32 faction_id, uint32 Reputation,
 
 void Battleground::UpdateWorldState(uint32 Field, uint32 Value)
 {
-    WorldPacket data;
-    sBattlegroundMgr->BuildUpdateWorldStatePacket(&data, Field, Value);
-    SendPacketToAll(&data);
+    // queued until the end of the tick, the last value set for a field wins
+    std::pair<std::map<uint32, uint32>::iterator, bool> res = m_PendingWorldStates.insert(std::make_pair(Field, Value));
+    if (!res.second)
+    {
+        res.first->second = Value;
+        ++m_CoalescedWorldStates;
+    }
+}
+
+void Battleground::FlushWorldStates()
+{
+    if (m_PendingWorldStates.empty())
+        return;
+
+    for (std::map<uint32, uint32>::const_iterator itr = m_PendingWorldStates.begin(); itr != m_PendingWorldStates.end(); ++itr)
+    {
+        WorldPacket data;
+        sBattlegroundMgr->BuildUpdateWorldStatePacket(&data, itr->first, itr->second);
+        SendPacketToAll(&data);
+    }
+
+    if (m_CoalescedWorldStates)
+        sWorld->IncreaseSavedWorldStatePacketCount(m_CoalescedWorldStates * GetPlayersSize());
+
+    m_PendingWorldStates.clear();
+    m_CoalescedWorldStates = 0;
 }
 
 void Battleground::UpdateWorldStateForPlayer(uint32 Field, uint32 Value, Player* Source)
@@ -747,6 +773,9 @@ void Battleground::UpdateWorldStateForPlayer(uint32 Field, uint32 Value, Player*
 
 void Battleground::EndBattleground(uint32 winner)
 {
+    // arena teams are shared by all arenas, which end on their own map threads
+    TRINITY_GUARD(ACE_Recursive_Thread_Mutex, sArenaTeamMgr->ArenaTeamLock);
+
     RemoveFromBGFreeSlotQueue();
 
     ArenaTeam* winner_arena_team = NULL;
@@ -1041,6 +1070,8 @@ void Battleground::RemovePlayerAtLeave(uint64 guid, bool Transport, bool SendPac
 
                 if (isRated() && GetStatus() == STATUS_IN_PROGRESS)
                 {
+                    TRINITY_GUARD(ACE_Recursive_Thread_Mutex, sArenaTeamMgr->ArenaTeamLock);
+
                     //left a rated match while the encounter was in progress, consider as loser
                     ArenaTeam* winner_arena_team = sArenaTeamMgr->GetArenaTeamById(GetArenaTeamIdForTeam(GetOtherTeam(team)));
                     ArenaTeam* loser_arena_team = sArenaTeamMgr->GetArenaTeamById(GetArenaTeamIdForTeam(team));
@@ -1071,6 +1102,8 @@ void Battleground::RemovePlayerAtLeave(uint64 guid, bool Transport, bool SendPac
         {
             if (isRated() && GetStatus() == STATUS_IN_PROGRESS)
             {
+                TRINITY_GUARD(ACE_Recursive_Thread_Mutex, sArenaTeamMgr->ArenaTeamLock);
+
                 //left a rated match while the encounter was in progress, consider as loser
                 ArenaTeam* others_arena_team = sArenaTeamMgr->GetArenaTeamById(GetArenaTeamIdForTeam(GetOtherTeam(team)));
                 ArenaTeam* players_arena_team = sArenaTeamMgr->GetArenaTeamById(GetArenaTeamIdForTeam(team));
@@ -1144,6 +1177,9 @@ void Battleground::Reset()
 
     m_Players.clear();
 
+    m_PendingWorldStates.clear();
+    m_CoalescedWorldStates = 0;
+
     for (BattlegroundScoreMap::const_iterator itr = PlayerScores.begin(); itr != PlayerScores.end(); ++itr)
         delete itr->second;
     PlayerScores.clear();
@@ -1348,6 +1384,7 @@ void Battleground::AddToBGFreeSlotQueue()
     // make sure to add only once
     if (!m_InBGFreeSlotQueue && isBattleground())
     {
+        TRINITY_GUARD(ACE_Thread_Mutex, sBattlegroundMgr->BGFreeSlotQueueLock);
         sBattlegroundMgr->BGFreeSlotQueue[m_TypeID].push_front(this);
         m_InBGFreeSlotQueue = true;
     }
@@ -1358,6 +1395,7 @@ void Battleground::RemoveFromBGFreeSlotQueue()
 {
     // set to be able to re-add if needed
     m_InBGFreeSlotQueue = false;
+    TRINITY_GUARD(ACE_Thread_Mutex, sBattlegroundMgr->BGFreeSlotQueueLock);
     // uncomment this code when battlegrounds will work like instances
     for (BGFreeSlotQueueType::iterator itr = sBattlegroundMgr->BGFreeSlotQueue[m_TypeID].begin(); itr != sBattlegroundMgr->BGFreeSlotQueue[m_TypeID].end(); ++itr)
     {
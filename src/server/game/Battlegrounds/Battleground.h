@@ -497,6 +497,7 @@ class Battleground
         void RewardHonorToTeam(uint32 Honor, uint32 TeamID);
         void RewardReputationToTeam(uint32 faction_id, uint32 Reputation, uint32 TeamID, uint32 enemy_faction_id = 0);
         void UpdateWorldState(uint32 Field, uint32 Value);
+        void FlushWorldStates();
         void UpdateWorldStateForPlayer(uint32 Field, uint32 Value, Player* Source);
         void EndBattleground(uint32 winner);
         void BlockMovement(Player* player);
@@ -613,6 +614,10 @@ class Battleground
         bool ToBeDeleted() const { return m_SetDeleteThis; }
         void SetDeleteThis() { m_SetDeleteThis = true; }
 
+        // the world wide start announcement is sent by BattlegroundMgr::Update, outside of the map threads
+        bool IsStartAnnouncementPending() const { return m_StartAnnouncementPending; }
+        void ClearStartAnnouncement() { m_StartAnnouncementPending = false; }
+
         // virtual score-array - get's used in bg-subclasses
         int32 m_TeamScores[BG_TEAMS_COUNT];
 
@@ -652,6 +657,9 @@ class Battleground
 
         // Player lists, those need to be accessible by inherited classes
         BattlegroundPlayerMap  m_Players;
+        // World states changed this tick, sent once per field by FlushWorldStates()
+        std::map<uint32, uint32> m_PendingWorldStates;
+        uint32 m_CoalescedWorldStates;
         // Spirit Guide guid + Player list GUIDS
         std::map<uint64, std::vector<uint64> >  m_ReviveQueue;
         std::map<uint64, std::vector<uint64> >  m_TeleportQueue;
@@ -682,6 +690,7 @@ class Battleground
         uint8  m_ArenaType;                                 // 2=2v2, 3=3v3, 5=5v5
         bool   m_InBGFreeSlotQueue;                         // used to make sure that BG is only once inserted into the BattlegroundMgr.BGFreeSlotQueue[bgTypeId] deque
         bool   m_SetDeleteThis;                             // used for safe deletion of the bg after end / all players leave
+        bool   m_StartAnnouncementPending;
         bool   m_IsArena;
         uint8  m_Winner;                                    // 0=alliance, 1=horde, 2=none
         int32  m_StartDelayTime;
@@ -107,7 +107,18 @@ void BattlegroundMgr::Update(uint32 diff)
         {
             next = itr;
             ++next;
-            itr->second->Update(diff);
+            // battlegrounds with a map are updated by their BattlegroundMap on the map threads,
+            // only the ones still waiting for their first player are updated here
+            if (!itr->second->FindBgMap())
+            {
+                itr->second->Update(diff);
+                itr->second->FlushWorldStates();
+            }
+            if (itr->second->IsStartAnnouncementPending())
+            {
+                itr->second->ClearStartAnnouncement();
+                sWorld->SendWorldText(LANG_BG_STARTED_ANNOUNCE_WORLD, itr->second->GetName(), itr->second->GetMinLevel(), itr->second->GetMaxLevel());
+            }
             // use the SetDeleteThis variable
             // direct deletion caused crashes
             if (itr->second->ToBeDeleted())
@@ -131,14 +142,19 @@ void BattlegroundMgr::Update(uint32 diff)
     {
         std::vector<uint64> scheduled;
         {
-            //copy vector and clear the other
-            scheduled = std::vector<uint64>(m_QueueUpdateScheduler);
-            m_QueueUpdateScheduler.clear();
-            //release lock
+            TRINITY_GUARD(ACE_Thread_Mutex, SchedulerLock);
+            scheduled.swap(m_QueueUpdateScheduler);
         }
 
-        for (uint8 i = 0; i < scheduled.size(); i++)
+        // stop once the matchmaking budget is spent, the rest waits for the next update
+        uint32 budget = sWorld->getIntConfig(CONFIG_MATCHMAKING_UPDATE_BUDGET);
+        uint32 startTime = getMSTime();
+        size_t i = 0;
+        for (; i < scheduled.size(); ++i)
         {
+            if (budget && i && getMSTimeDiff(startTime, getMSTime()) >= budget)
+                break;
+
             uint32 arenaMMRating = scheduled[i] >> 32;
             uint8 arenaType = scheduled[i] >> 24 & 255;
             BattlegroundQueueTypeId bgQueueTypeId = BattlegroundQueueTypeId(scheduled[i] >> 16 & 255);
@@ -146,6 +162,17 @@ void BattlegroundMgr::Update(uint32 diff)
             BattlegroundBracketId bracket_id = BattlegroundBracketId(scheduled[i] & 255);
             m_BattlegroundQueues[bgQueueTypeId].BattlegroundQueueUpdate(diff, bgTypeId, bracket_id, arenaType, arenaMMRating > 0, arenaMMRating);
         }
+
+        if (i < scheduled.size())
+        {
+            // left over queues go first, then the ones scheduled while updating
+            std::vector<uint64> rescheduled(scheduled.begin() + i, scheduled.end());
+            TRINITY_GUARD(ACE_Thread_Mutex, SchedulerLock);
+            for (std::vector<uint64>::const_iterator itr = m_QueueUpdateScheduler.begin(); itr != m_QueueUpdateScheduler.end(); ++itr)
+                if (std::find(rescheduled.begin(), rescheduled.end(), *itr) == rescheduled.end())
+                    rescheduled.push_back(*itr);
+            m_QueueUpdateScheduler.swap(rescheduled);
+        }
     }
 
     // if rating difference counts, maybe force-update queues
@@ -1065,19 +1092,11 @@ void BattlegroundMgr::SetHolidayWeekends(uint32 mask)
 
 void BattlegroundMgr::ScheduleQueueUpdate(uint32 arenaMatchmakerRating, uint8 arenaType, BattlegroundQueueTypeId bgQueueTypeId, BattlegroundTypeId bgTypeId, BattlegroundBracketId bracket_id)
 {
-    //This method must be atomic, TODO add mutex
     //we will use only 1 number created of bgTypeId and bracket_id
     uint64 schedule_id = ((uint64)arenaMatchmakerRating << 32) | (arenaType << 24) | (bgQueueTypeId << 16) | (bgTypeId << 8) | bracket_id;
-    bool found = false;
-    for (uint8 i = 0; i < m_QueueUpdateScheduler.size(); i++)
-    {
-        if (m_QueueUpdateScheduler[i] == schedule_id)
-        {
-            found = true;
-            break;
-        }
-    }
-    if (!found)
+    // battlegrounds call this from their map threads
+    TRINITY_GUARD(ACE_Thread_Mutex, SchedulerLock);
+    if (std::find(m_QueueUpdateScheduler.begin(), m_QueueUpdateScheduler.end(), schedule_id) == m_QueueUpdateScheduler.end())
         m_QueueUpdateScheduler.push_back(schedule_id);
 }
 
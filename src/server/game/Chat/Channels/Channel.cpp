@@ -195,6 +195,8 @@ void Channel::Join(uint64 p, const char *pass)
     pinfo.player = p;
     pinfo.flags = MEMBER_FLAG_NONE;
     players[p] = pinfo;
+    if (player)
+        AddMember(player);
 
     MakeYouJoined(&data);
     SendToOne(&data, p);
@@ -245,6 +247,7 @@ void Channel::Leave(uint64 p, bool send)
         bool changeowner = players[p].IsOwner();
 
         players.erase(p);
+        RemoveMember(p);
         if (m_announce && (!player || !AccountMgr::IsGMAccount(player->GetSession()->GetSecurity()) || !sWorld->getBoolConfig(CONFIG_SILENTLY_GM_JOIN_TO_CHANNEL)))
         {
             WorldPacket data;
@@ -326,6 +329,7 @@ void Channel::KickOrBan(uint64 good, const char *badname, bool ban)
                 SendToAll(&data);
 
             players.erase(bad->GetGUID());
+            RemoveMember(bad->GetGUID());
             bad->LeftChannel(this);
 
             if (changeowner && m_ownership && !players.empty())
@@ -748,30 +752,38 @@ void Channel::SetOwner(uint64 guid, bool exclaim)
     }
 }
 
-void Channel::SendToAll(WorldPacket* data, uint64 p)
+void Channel::AddMember(Player* player)
+{
+    members.push_back(player);
+}
+
+void Channel::RemoveMember(uint64 guid)
 {
-    for (PlayerList::const_iterator i = players.begin(); i != players.end(); ++i)
+    for (MemberList::iterator i = members.begin(); i != members.end(); ++i)
     {
-        Player* player = ObjectAccessor::FindPlayer(i->first);
-        if (player)
+        if ((*i)->GetGUID() == guid)
         {
-            if (!p || !player->GetSocial()->HasIgnore(GUID_LOPART(p)))
-                player->GetSession()->SendPacket(data);
+            *i = members.back();
+            members.pop_back();
+            return;
         }
     }
 }
 
+void Channel::SendToAll(WorldPacket* data, uint64 p)
+{
+    // Packet is built once by the caller, every member gets the same buffer
+    uint32 ignored = GUID_LOPART(p);
+    for (MemberList::const_iterator i = members.begin(); i != members.end(); ++i)
+        if (!p || !(*i)->GetSocial()->HasIgnore(ignored))
+            (*i)->GetSession()->SendPacket(data);
+}
+
 void Channel::SendToAllButOne(WorldPacket* data, uint64 who)
 {
-    for (PlayerList::const_iterator i = players.begin(); i != players.end(); ++i)
-    {
-        if (i->first != who)
-        {
-            Player* player = ObjectAccessor::FindPlayer(i->first);
-            if (player)
-                player->GetSession()->SendPacket(data);
-        }
-    }
+    for (MemberList::const_iterator i = members.begin(); i != members.end(); ++i)
+        if ((*i)->GetGUID() != who)
+            (*i)->GetSession()->SendPacket(data);
 }
 
 void Channel::SendToOne(WorldPacket* data, uint64 who)
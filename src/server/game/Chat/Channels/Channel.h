@@ -148,6 +148,8 @@ class Channel
 
     typedef     std::map<uint64, PlayerInfo> PlayerList;
     PlayerList  players;
+    typedef     std::vector<Player*> MemberList;
+    MemberList  members;                                    // flat list of online members, broadcasts iterate this
     typedef     std::set<uint64> BannedList;
     BannedList  banned;
     bool        m_announce;
@@ -202,6 +204,9 @@ class Channel
         void SendToAllButOne(WorldPacket* data, uint64 who);
         void SendToOne(WorldPacket* data, uint64 who);
 
+        void AddMember(Player* player);
+        void RemoveMember(uint64 guid);
+
         bool IsOn(uint64 who) const { return players.find(who) != players.end(); }
         bool IsBanned(uint64 guid) const { return banned.find(guid) != banned.end(); }
 
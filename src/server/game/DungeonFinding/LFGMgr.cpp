@@ -291,15 +291,22 @@ namespace lfg
             }
         }
 
-        // Check if a proposal can be formed with the new groups being added
+        // Check if a proposal can be formed with the new groups being added.
+        // Every queue checks at least one new group, the rest waits for the next update once the budget is spent
+        uint32 budget = sWorld->getIntConfig(CONFIG_MATCHMAKING_UPDATE_BUDGET);
+        uint32 matchStartTime = getMSTime();
         for (LfgGuidListMap::iterator it = m_newToQueue.begin(); it != m_newToQueue.end(); ++it)
         {
             uint8 queueId = it->first;
             LfgGuidList& newToQueue = it->second;
             LfgGuidList& currentQueue = m_currentQueue[queueId];
             LfgGuidList firstNew;
+            uint32 checked = 0;
             while (!newToQueue.empty())
             {
+                if (budget && checked++ && getMSTimeDiff(matchStartTime, getMSTime()) >= budget)
+                    break;
+
                 uint64 frontguid = newToQueue.front();
                 sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::Update: QueueId %u: checking [" UI64FMTD "] newToQueue(%u), currentQueue(%u)", queueId, frontguid, uint32(newToQueue.size()), uint32(currentQueue.size()));
                 firstNew.push_back(frontguid);
@@ -922,7 +929,8 @@ namespace lfg
     */
     LfgProposal* LFGMgr::FindNewGroups(LfgGuidList& check, LfgGuidList& all)
     {
-        sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::FindNewGroup: (%s) - all(%s)", ConcatenateGuids(check).c_str(), ConcatenateGuids(all).c_str());
+        if (sLog->IsOutDebug(LOG_FILTER_LFG))
+            sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::FindNewGroup: (%s) - all(%s)", ConcatenateGuids(check).c_str(), ConcatenateGuids(all).c_str());
 
         LfgProposal* pProposal = NULL;
         if (check.empty() || check.size() > MAXGROUPSIZE || !CheckCompatibility(check, pProposal))
@@ -951,7 +959,10 @@ namespace lfg
         if (pProposal)                                         // Do not check anything if we already have a proposal
             return false;
 
-        std::string strGuids = ConcatenateGuids(check);
+        // Only needed for debug output, building it for every subset checked is not free
+        std::string strGuids;
+        if (sLog->IsOutDebug(LOG_FILTER_LFG))
+            strGuids = ConcatenateGuids(check);
 
         if (check.size() > MAXGROUPSIZE || check.empty())
         {
@@ -962,8 +973,10 @@ namespace lfg
         if (check.size() == 1 && IS_PLAYER_GUID(check.front())) // Player joining dungeon... compatible
             return true;
 
+        LfgCompatibilityKey key(check);
+
         // Previously cached?
-        LfgAnswer answer = GetCompatibles(strGuids);
+        LfgAnswer answer = GetCompatibles(key);
         if (answer != LFG_ANSWER_PENDING)
         {
             sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) compatibles (cached): %d", strGuids.c_str(), answer);
@@ -979,8 +992,9 @@ namespace lfg
             // Check all-but-new compatibilities (New, A, B, C, D) --> check(A, B, C, D)
             if (!CheckCompatibility(check, pProposal))          // Group not compatible
             {
-                sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) not compatibles (%s not compatibles)", strGuids.c_str(), ConcatenateGuids(check).c_str());
-                SetCompatibles(strGuids, false);
+                if (sLog->IsOutDebug(LOG_FILTER_LFG))
+                    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) not compatibles (%s not compatibles)", strGuids.c_str(), ConcatenateGuids(check).c_str());
+                SetCompatibles(key, false);
                 return false;
             }
             check.push_front(frontGuid);
@@ -1023,7 +1037,7 @@ namespace lfg
         // Do not match - groups already in a lfgDungeon or too much players
         if (numLfgGroups > 1 || numPlayers > MAXGROUPSIZE)
         {
-            SetCompatibles(strGuids, false);
+            SetCompatibles(key, false);
             if (numLfgGroups > 1)
                 sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) More than one Lfggroup (%u)", strGuids.c_str(), numLfgGroups);
             else
@@ -1077,7 +1091,7 @@ namespace lfg
         {
             if (players.size() == numPlayers)
                 sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) Roles not compatible", strGuids.c_str());
-            SetCompatibles(strGuids, false);
+            SetCompatibles(key, false);
             return false;
         }
 
@@ -1101,10 +1115,10 @@ namespace lfg
 
         if (compatibleDungeons.empty())
         {
-            SetCompatibles(strGuids, false);
+            SetCompatibles(key, false);
             return false;
         }
-        SetCompatibles(strGuids, true);
+        SetCompatibles(key, true);
 
         // ----- Group is compatible, if we have MAXGROUPSIZE members then match is found
         if (numPlayers != MAXGROUPSIZE)
@@ -1127,24 +1141,16 @@ namespace lfg
                         --Dps_Needed;
                 }
             }
-            for (PlayerSet::const_iterator itPlayers = players.begin(); itPlayers != players.end(); ++itPlayers)
+            // Every queued member was found online above, so all queues take part in this group
+            for (LfgQueueInfoMap::const_iterator itQueue = pqInfoMap.begin(); itQueue != pqInfoMap.end(); ++itQueue)
             {
-                for (LfgQueueInfoMap::const_iterator itQueue = pqInfoMap.begin(); itQueue != pqInfoMap.end(); ++itQueue)
-                {
-                    LfgQueueInfo* queue = itQueue->second;
-                    if (!queue)
-                        continue;
+                LfgQueueInfo* queue = itQueue->second;
+                if (!queue || queue->roles.empty())
+                    continue;
 
-                    for (LfgRolesMap::const_iterator itPlayer = queue->roles.begin(); itPlayer != queue->roles.end(); ++itPlayer)
-                    {
-                        if (*itPlayers == ObjectAccessor::FindPlayer(itPlayer->first))
-                        {
-                            queue->tanks = Tanks_Needed;
-                            queue->healers = Healers_Needed;
-                            queue->dps = Dps_Needed;
-                        }
-                    }
-                }
+                queue->tanks = Tanks_Needed;
+                queue->healers = Healers_Needed;
+                queue->dps = Dps_Needed;
             }
             return true;
         }
@@ -1325,15 +1331,11 @@ namespace lfg
     */
     void LFGMgr::RemoveFromCompatibles(uint64 guid)
     {
-        std::stringstream out;
-        out << guid;
-        std::string strGuid = out.str();
-
         sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::RemoveFromCompatibles: Removing [" UI64FMTD "]", guid);
         for (LfgCompatibleMap::iterator itNext = m_CompatibleMap.begin(); itNext != m_CompatibleMap.end();)
         {
             LfgCompatibleMap::iterator it = itNext++;
-            if (it->first.find(strGuid) != std::string::npos)  // Found, remove it
+            if (it->first.Contains(guid))                      // Found, remove it
                 m_CompatibleMap.erase(it);
         }
     }
@@ -1341,10 +1343,10 @@ namespace lfg
     /**
     Stores the compatibility of a list of guids
 
-    @param[in]     key String concatenation of guids (| used as separator)
+    @param[in]     key Sorted guids checked together
     @param[in]     compatibles Compatibles or not
     */
-    void LFGMgr::SetCompatibles(std::string key, bool compatibles)
+    void LFGMgr::SetCompatibles(LfgCompatibilityKey const& key, bool compatibles)
     {
         m_CompatibleMap[key] = LfgAnswer(compatibles);
     }
@@ -1352,10 +1354,10 @@ namespace lfg
     /**
     Get the compatibility of a group of guids
 
-    @param[in]     key String concatenation of guids (| used as separator)
+    @param[in]     key Sorted guids checked together
     @return 1 (Compatibles), 0 (Not compatibles), -1 (Not set)
     */
-    LfgAnswer LFGMgr::GetCompatibles(std::string key)
+    LfgAnswer LFGMgr::GetCompatibles(LfgCompatibilityKey const& key)
     {
         LfgAnswer answer = LFG_ANSWER_PENDING;
         LfgCompatibleMap::iterator it = m_CompatibleMap.find(key);
@@ -2165,6 +2167,26 @@ namespace lfg
         return LfgType(dungeon->type);
     }
 
+    LfgCompatibilityKey::LfgCompatibilityKey(LfgGuidList const& check) : count(0)
+    {
+        memset(guids, 0, sizeof(guids));
+        for (LfgGuidList::const_iterator it = check.begin(); it != check.end() && count < MAXGROUPSIZE; ++it)
+            guids[count++] = *it;
+        std::sort(guids, guids + count);
+    }
+
+    bool LfgCompatibilityKey::Contains(uint64 guid) const
+    {
+        return std::binary_search(guids, guids + count, guid);
+    }
+
+    bool LfgCompatibilityKey::operator<(LfgCompatibilityKey const& right) const
+    {
+        if (count != right.count)
+            return count < right.count;
+        return std::lexicographical_compare(guids, guids + count, right.guids, right.guids + count);
+    }
+
     /**
     Given a list of guids returns the concatenation using | as delimiter
 
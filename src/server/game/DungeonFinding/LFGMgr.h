@@ -156,7 +156,20 @@ typedef std::set<Player*> PlayerSet;
 typedef std::list<Player*> LfgPlayerList;
 typedef std::multimap<uint32, LfgReward const*> LfgRewardMap;
 typedef std::pair<LfgRewardMap::const_iterator, LfgRewardMap::const_iterator> LfgRewardMapBounds;
-typedef std::map<std::string, LfgAnswer> LfgCompatibleMap;
+
+/// Order independent key of the guids checked together for compatibility
+struct LfgCompatibilityKey
+{
+    explicit LfgCompatibilityKey(LfgGuidList const& check);
+
+    bool Contains(uint64 guid) const;
+    bool operator<(LfgCompatibilityKey const& right) const;
+
+    uint64 guids[MAXGROUPSIZE];                        ///< Sorted guids, unused slots are 0
+    uint8 count;
+};
+
+typedef std::map<LfgCompatibilityKey, LfgAnswer> LfgCompatibleMap;
 typedef std::map<uint64, LfgDungeonSet> LfgDungeonMap;
 typedef std::map<uint32, AreaTrigger*> LfgSeasonMap;
 typedef std::map<uint64, uint8> LfgRolesMap;
@@ -368,8 +381,8 @@ class LFGMgr
         bool CheckGroupRoles(LfgRolesMap &groles, bool removeLeaderFlag = true);
         bool CheckCompatibility(LfgGuidList check, LfgProposal*& pProposal);
         void GetCompatibleDungeons(LfgDungeonSet& dungeons, const PlayerSet& players, LfgLockPartyMap& lockMap);
-        void SetCompatibles(std::string concatenatedGuids, bool compatibles);
-        LfgAnswer GetCompatibles(std::string concatenatedGuids);
+        void SetCompatibles(LfgCompatibilityKey const& key, bool compatibles);
+        LfgAnswer GetCompatibles(LfgCompatibilityKey const& key);
         void RemoveFromCompatibles(uint64 guid);
 
         // Generic
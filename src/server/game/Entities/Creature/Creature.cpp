@@ -145,7 +145,7 @@ m_PlayerDamageReq(0), m_lootRecipient(0), m_lootRecipientGroup(0), m_corpseRemov
 m_respawnDelay(300), m_corpseDelay(60), m_respawnradius(0.0f), m_reactState(REACT_AGGRESSIVE),
 m_defaultMovementType(IDLE_MOTION_TYPE), m_DBTableGuid(0), m_equipmentId(0), m_AlreadyCallAssistance(false),
 m_AlreadySearchedAssistance(false), m_regenHealth(true), m_AI_locked(false), m_meleeDamageSchoolMask(SPELL_SCHOOL_MASK_NORMAL),
-m_creatureInfo(NULL), m_creatureData(NULL), m_path_id(0), m_formation(NULL)
+m_creatureInfo(NULL), m_creatureData(NULL), m_path_id(0), m_formation(NULL), m_sleepTimer(0), m_sleepDiff(0)
 {
     m_regenTimer = CREATURE_REGEN_INTERVAL;
     m_valuesCount = UNIT_END;
@@ -445,6 +445,45 @@ bool Creature::UpdateEntry(uint32 Entry, uint32 team, const CreatureData* data)
     return true;
 }
 
+bool Creature::CanSleep() const
+{
+    if (!sWorld->getIntConfig(CONFIG_CREATURE_IDLE_UPDATE_INTERVAL))
+        return false;
+
+    // anything fighting, moving or casting needs every update
+    if (isInCombat() || getVictim() || IsInEvadeMode() || !movespline->Finalized() || IsNonMeleeSpellCasted(false))
+        return false;
+
+    // summons, pets, charmed units and vehicles are driven by their owner or scripts
+    if (isSummon() || IsControlledByPlayer() || GetCharmerGUID() || GetVehicleKit() || GetVehicle())
+        return false;
+
+    if (isActiveObject() || TriggerJustRespawned)
+        return false;
+
+    return true;
+}
+
+bool Creature::PrepareUpdate(uint32& diff)
+{
+    if (!CanSleep())
+    {
+        diff += m_sleepDiff;
+        m_sleepDiff = 0;
+        m_sleepTimer = 0;
+        return true;
+    }
+
+    m_sleepDiff += diff;
+    if (m_sleepDiff < m_sleepTimer)
+        return false;
+
+    diff = m_sleepDiff;
+    m_sleepDiff = 0;
+    m_sleepTimer = sWorld->getIntConfig(CONFIG_CREATURE_IDLE_UPDATE_INTERVAL);
+    return true;
+}
+
 void Creature::Update(uint32 diff)
 {
     if (IsAIEnabled && TriggerJustRespawned)
@@ -479,6 +518,15 @@ void Creature::Update(uint32 diff)
         case DEAD:
         {
             time_t now = time(NULL);
+            if (m_respawnTime > now && !isSummon() && GetMap()->CanUnloadCreatureUntilRespawn(m_DBTableGuid))
+            {
+                // nothing left to do until the respawn, the map recreates the creature then
+                SaveRespawnTime();
+                GetMap()->AddCreatureAwaitingRespawn(m_DBTableGuid);
+                AddObjectToRemoveList();
+                break;
+            }
+
             if (m_respawnTime <= now)
             {
                 bool allowed = IsAIEnabled ? AI()->CanRespawn() : true;     // First check if there are any scripts that object to us respawning
@@ -26,6 +26,7 @@
 #include "LootMgr.h"
 #include "DatabaseEnv.h"
 #include "Cell.h"
+#include "ObjectPool.h"
 
 #include <list>
 
@@ -409,7 +410,7 @@ typedef std::map<uint32, time_t> CreatureSpellCooldowns;
 
 #define MAX_VENDOR_ITEMS 150                                // Limitation in 3.x.x item count in SMSG_LIST_INVENTORY
 
-class Creature : public Unit, public GridObject<Creature>, public MapObject
+class Creature : public Unit, public GridObject<Creature>, public MapObject, public PooledObject
 {
     public:
 
@@ -429,6 +430,12 @@ class Creature : public Unit, public GridObject<Creature>, public MapObject
         uint32 GetDBTableGUIDLow() const { return m_DBTableGuid; }
 
         void Update(uint32 time);                         // overwrited Unit::Update
+
+        // idle creatures are updated every CreatureIdleUpdateInterval with the accumulated diff,
+        // returns false if this update is skipped
+        bool PrepareUpdate(uint32& diff);
+        bool CanSleep() const;
+        void WakeUp() { m_sleepTimer = 0; }
         void GetRespawnPosition(float &x, float &y, float &z, float* ori = NULL, float* dist = NULL) const;
         uint32 GetEquipmentId() const { return GetCreatureTemplate()->equipmentId; }
 
@@ -755,6 +762,9 @@ class Creature : public Unit, public GridObject<Creature>, public MapObject
         //Formation var
         CreatureGroup* m_formation;
         bool TriggerJustRespawned;
+
+        uint32 m_sleepTimer;                                // time until the next update of a sleeping creature
+        uint32 m_sleepDiff;                                 // diff accumulated while sleeping
 };
 
 class AssistDelayEvent : public BasicEvent
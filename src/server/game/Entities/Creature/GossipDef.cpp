@@ -442,6 +442,11 @@ void PlayerMenu::SendQuestGiverQuestDetails(Quest const* quest, uint64 npcGUID,
 
 void PlayerMenu::SendQuestQueryResponse(Quest const* quest) const
 {
+    // rewarded honor depends on the player level, only quests without it are the same for everyone
+    bool cacheable = !quest->GetRewHonorMultiplier();
+    if (cacheable && sObjectMgr->SendCachedQueryResponse(_session, QUERY_RESPONSE_QUEST, quest->GetQuestId()))
+        return;
+
     std::string questTitle = quest->GetTitle();
     std::string questDetails = quest->GetDetails();
     std::string questObjectives = quest->GetObjectives();
@@ -570,6 +575,9 @@ void PlayerMenu::SendQuestQueryResponse(Quest const* quest) const
     for (uint32 i = 0; i < QUEST_OBJECTIVES_COUNT; ++i)
         data << questObjectiveText[i];
 
+    if (cacheable)
+        sObjectMgr->CacheQueryResponse(_session, QUERY_RESPONSE_QUEST, quest->GetQuestId(), data);
+
     _session->SendPacket(&data);
     sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: Sent SMSG_QUEST_QUERY_RESPONSE questid=%u", quest->GetQuestId());
 }
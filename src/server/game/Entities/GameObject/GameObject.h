@@ -25,6 +25,7 @@
 #include "Object.h"
 #include "LootMgr.h"
 #include "DatabaseEnv.h"
+#include "ObjectPool.h"
 
 class GameObjectAI;
 
@@ -622,7 +623,7 @@ class GameObjectModel;
 // 5 sec for bobber catch
 #define FISHING_BOBBER_READY_TIME 5
 
-class GameObject : public WorldObject, public GridObject<GameObject>, public MapObject
+class GameObject : public WorldObject, public GridObject<GameObject>, public MapObject, public PooledObject
 {
     public:
         explicit GameObject();
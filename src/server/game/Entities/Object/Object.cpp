@@ -83,6 +83,8 @@ Object::Object() : m_PackGUID(sizeof(uint64)+1)
     m_inWorld           = false;
     m_objectUpdated     = false;
 
+    _sharedValuesUpdates = NULL;
+
     m_PackGUID.appendPackGUID(0);
 }
 
@@ -478,6 +480,16 @@ void Object::_BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* targ
     uint32* flags = NULL;
     uint32 visibleFlag = _GetUpdateFieldData(target, flags);
 
+    bool shareable = updateType == UPDATETYPE_VALUES && _sharedValuesUpdates;
+    if (shareable)
+    {
+        if (SharedValuesUpdate const* shared = _FindSharedValuesUpdate(visibleFlag))
+        {
+            data->append(shared->Block);
+            return;
+        }
+    }
+
     for (uint16 index = 0; index < m_valuesCount; ++index)
     {
         if (_fieldNotifyFlags & flags[index] ||
@@ -488,9 +500,30 @@ void Object::_BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* targ
         }
     }
 
+    size_t start = data->wpos();
     *data << uint8(updateMask.GetBlockCount());
     updateMask.AppendToPacket(data);
     data->append(fieldBuffer);
+
+    if (shareable)
+        _AddSharedValuesUpdate(visibleFlag).Block.append(data->contents() + start, data->wpos() - start);
+}
+
+Object::SharedValuesUpdate const* Object::_FindSharedValuesUpdate(uint32 visibleFlags) const
+{
+    for (SharedValuesUpdateList::const_iterator itr = _sharedValuesUpdates->begin(); itr != _sharedValuesUpdates->end(); ++itr)
+        if (itr->VisibleFlags == visibleFlags)
+            return &*itr;
+
+    return NULL;
+}
+
+Object::SharedValuesUpdate& Object::_AddSharedValuesUpdate(uint32 visibleFlags) const
+{
+    _sharedValuesUpdates->push_back(SharedValuesUpdate());
+    SharedValuesUpdate& shared = _sharedValuesUpdates->back();
+    shared.VisibleFlags = visibleFlags;
+    return shared;
 }
 
 void Object::ClearUpdateMask(bool remove)
@@ -1462,6 +1495,13 @@ float WorldObject::GetVisibilityRange() const
         return GetMap()->GetVisibilityRange();
 }
 
+// players keep objects at their client up to the leave margin beyond their sight range (see canSeeOrDetect),
+// updates of this object have to reach them that far
+float WorldObject::GetClientVisibilityRange() const
+{
+    return std::min(GetVisibilityRange() + sWorld->getFloatConfig(CONFIG_VISIBILITY_LEAVE_MARGIN), MAX_VISIBILITY_DISTANCE);
+}
+
 float WorldObject::GetSightRange(const WorldObject* target) const
 {
     if (ToUnit())
@@ -1497,16 +1537,22 @@ bool WorldObject::canSeeOrDetect(WorldObject const* obj, bool ignoreStealth, boo
     bool corpseVisibility = false;
     if (distanceCheck)
     {
+        float sightRange = GetSightRange(obj);
         if (Player const* thisPlayer = ToPlayer())
         {
+            // objects at the client are only removed once they are farther away than the margin,
+            // so objects moving along the edge of the sight range are not created and destroyed all the time
+            if (thisPlayer->HaveAtClient(obj))
+                sightRange = std::min(sightRange + sWorld->getFloatConfig(CONFIG_VISIBILITY_LEAVE_MARGIN), MAX_VISIBILITY_DISTANCE);
+
             if (thisPlayer->isDead() && thisPlayer->GetHealth() > 0 && // Cheap way to check for ghost state
                 !(obj->m_serverSideVisibility.GetValue(SERVERSIDE_VISIBILITY_GHOST) & m_serverSideVisibility.GetValue(SERVERSIDE_VISIBILITY_GHOST) & GHOST_VISIBILITY_GHOST))
             {
                 if (Corpse* corpse = thisPlayer->GetCorpse())
                 {
                     corpseCheck = true;
-                    if (corpse->IsWithinDist(thisPlayer, GetSightRange(obj), false))
-                        if (corpse->IsWithinDist(obj, GetSightRange(obj), false))
+                    if (corpse->IsWithinDist(thisPlayer, sightRange, false))
+                        if (corpse->IsWithinDist(obj, sightRange, false))
                             corpseVisibility = true;
                 }
             }
@@ -1519,7 +1565,7 @@ bool WorldObject::canSeeOrDetect(WorldObject const* obj, bool ignoreStealth, boo
         if (!viewpoint)
             viewpoint = this;
 
-        if (!corpseCheck && !viewpoint->IsWithinDist(obj, GetSightRange(obj), false))
+        if (!corpseCheck && !viewpoint->IsWithinDist(obj, sightRange, false))
             return false;
     }
 
@@ -1900,7 +1946,7 @@ void Unit::BuildHeartBeatMsg(WorldPacket* data) const
 void WorldObject::SendMessageToSet(WorldPacket* data, bool self)
 {
     if (IsInWorld())
-        SendMessageToSetInRange(data, GetVisibilityRange(), self);
+        SendMessageToSetInRange(data, GetClientVisibilityRange(), self);
 }
 
 void WorldObject::SendMessageToSetInRange(WorldPacket* data, float dist, bool /*self*/)
@@ -1911,8 +1957,24 @@ void WorldObject::SendMessageToSetInRange(WorldPacket* data, float dist, bool /*
 
 void WorldObject::SendMessageToSet(WorldPacket* data, Player const* skipped_rcvr)
 {
-    Trinity::MessageDistDeliverer notifier(this, data, GetVisibilityRange(), false, skipped_rcvr);
-    VisitNearbyWorldObject(GetVisibilityRange(), notifier);
+    Trinity::MessageDistDeliverer notifier(this, data, GetClientVisibilityRange(), false, skipped_rcvr);
+    VisitNearbyWorldObject(GetClientVisibilityRange(), notifier);
+}
+
+// same as SendMessageToSet but the receivers get the packet batched with the other movement at the end of the map update
+void WorldObject::SendMovementToSet(WorldPacket* data, Player const* skipped_rcvr)
+{
+    if (!sWorld->getBoolConfig(CONFIG_MOVEMENT_BATCHING))
+    {
+        SendMessageToSet(data, skipped_rcvr);
+        return;
+    }
+
+    if (GetTypeId() == TYPEID_PLAYER && skipped_rcvr != this)
+        ToPlayer()->QueueMovementRelay(data);
+
+    Trinity::MessageDistDeliverer notifier(this, data, GetClientVisibilityRange(), false, skipped_rcvr, true);
+    VisitNearbyWorldObject(GetClientVisibilityRange(), notifier);
 }
 
 void WorldObject::SendObjectDeSpawnAnim(uint64 guid)
@@ -2722,9 +2784,9 @@ void WorldObject::DestroyForNearbyPlayers()
         return;
 
     std::list<Player*> targets;
-    Trinity::AnyPlayerInObjectRangeCheck check(this, GetVisibilityRange(), false);
+    Trinity::AnyPlayerInObjectRangeCheck check(this, GetClientVisibilityRange(), false);
     Trinity::PlayerListSearcher<Trinity::AnyPlayerInObjectRangeCheck> searcher(this, targets, check);
-    VisitNearbyWorldObject(GetVisibilityRange(), searcher);
+    VisitNearbyWorldObject(GetClientVisibilityRange(), searcher);
     for (std::list<Player*>::const_iterator iter = targets.begin(); iter != targets.end(); ++iter)
     {
         Player* player = (*iter);
@@ -2747,7 +2809,7 @@ void WorldObject::UpdateObjectVisibility(bool /*forced*/)
 {
     //updates object's visibility for nearby players
     Trinity::VisibleChangesNotifier notifier(*this);
-    VisitNearbyWorldObject(GetVisibilityRange(), notifier);
+    VisitNearbyWorldObject(GetClientVisibilityRange(), notifier);
 }
 
 struct WorldObjectChangeAccumulator
@@ -2828,8 +2890,15 @@ void WorldObject::BuildUpdate(UpdateDataMapType& data_map)
     WorldObjectChangeAccumulator notifier(*this, data_map);
     TypeContainerVisitor<WorldObjectChangeAccumulator, WorldTypeMapContainer > player_notifier(notifier);
     Map& map = *GetMap();
+
+    // receivers with the same visibility flags get the same values block
+    SharedValuesUpdateList sharedValuesUpdates;
+    _sharedValuesUpdates = &sharedValuesUpdates;
+
     //we must build packets for all visible players
-    cell.Visit(p, player_notifier, map, *this, GetVisibilityRange());
+    cell.Visit(p, player_notifier, map, *this, GetClientVisibilityRange());
+
+    _sharedValuesUpdates = NULL;
 
     ClearUpdateMask(false);
 }
@@ -320,6 +320,19 @@ class Object
         void _BuildMovementUpdate(ByteBuffer * data, uint16 flags) const;
         virtual void _BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target) const;
 
+        // values update block built once per visibility flag combination while the object update is
+        // broadcast, TargetFields holds the offsets (in Block) of the fields that still depend on the receiver
+        struct SharedValuesUpdate
+        {
+            uint32 VisibleFlags;
+            ByteBuffer Block;
+            std::vector<std::pair<uint32, uint16> > TargetFields;
+        };
+        typedef std::vector<SharedValuesUpdate> SharedValuesUpdateList;
+
+        SharedValuesUpdate const* _FindSharedValuesUpdate(uint32 visibleFlags) const;
+        SharedValuesUpdate& _AddSharedValuesUpdate(uint32 visibleFlags) const;
+
         uint16 m_objectType;
 
         TypeID m_objectTypeId;
@@ -340,6 +353,9 @@ class Object
 
         bool m_objectUpdated;
 
+        // only set while WorldObject::BuildUpdate visits the receivers
+        mutable SharedValuesUpdateList* _sharedValuesUpdates;
+
     private:
         bool m_inWorld;
 
@@ -570,6 +586,8 @@ class GridObject
         bool IsInGrid() const { return _gridRef.isValid(); }
         void AddToGrid(GridRefManager<T>& m) { ASSERT(!IsInGrid()); _gridRef.link(&m, (T*)this); }
         void RemoveFromGrid() { ASSERT(IsInGrid()); _gridRef.unlink(); }
+    protected:
+        GridRefManager<T>* GetGridRefManager() const { return _gridRef.getTarget(); }
     private:
         GridReference<T> _gridRef;
 };
@@ -795,6 +813,7 @@ class WorldObject : public Object, public WorldLocation
         virtual void SendMessageToSet(WorldPacket* data, bool self);
         virtual void SendMessageToSetInRange(WorldPacket* data, float dist, bool self);
         virtual void SendMessageToSet(WorldPacket* data, Player const* skipped_rcvr);
+        void SendMovementToSet(WorldPacket* data, Player const* skipped_rcvr);
 
         virtual uint8 getLevelForTarget(WorldObject const* /*target*/) const { return 1; }
 
@@ -819,6 +838,7 @@ class WorldObject : public Object, public WorldLocation
 
         float GetGridActivationRange() const;
         float GetVisibilityRange() const;
+        float GetClientVisibilityRange() const;
         float GetSightRange(const WorldObject* target = NULL) const;
         bool canSeeOrDetect(WorldObject const* obj, bool ignoreStealth = false, bool distanceCheck = false) const;
 
@@ -66,12 +66,12 @@ class UpdateData
 
         GuidSet const& GetOutOfRangeGUIDs() const { return m_outOfRangeGUIDs; }
 
+        static void Compress(void* dst, uint32 *dst_size, void* src, int src_size);
+
     protected:
         uint32 m_blockCount;
         GuidSet m_outOfRangeGUIDs;
         ByteBuffer m_data;
-
-        void Compress(void* dst, uint32 *dst_size, void* src, int src_size);
 };
 #endif
 
@@ -39,26 +39,20 @@ class UpdateMask
         UpdateMask(UpdateMask const& right) : _bits(NULL)
         {
             SetCount(right.GetCount());
-            memcpy(_bits, right._bits, sizeof(uint8) * _blockCount * 32);
+            memcpy(_bits, right._bits, sizeof(ClientUpdateMaskType) * _blockCount);
         }
 
         ~UpdateMask() { delete[] _bits; }
 
-        void SetBit(uint32 index) { _bits[index] = 1; }
-        void UnsetBit(uint32 index) { _bits[index] = 0; }
-        bool GetBit(uint32 index) const { return _bits[index] != 0; }
+        // bits are stored packed in the client layout, one block per CLIENT_UPDATE_MASK_BITS fields
+        void SetBit(uint32 index) { _bits[index / CLIENT_UPDATE_MASK_BITS] |= ClientUpdateMaskType(1) << (index % CLIENT_UPDATE_MASK_BITS); }
+        void UnsetBit(uint32 index) { _bits[index / CLIENT_UPDATE_MASK_BITS] &= ~(ClientUpdateMaskType(1) << (index % CLIENT_UPDATE_MASK_BITS)); }
+        bool GetBit(uint32 index) const { return (_bits[index / CLIENT_UPDATE_MASK_BITS] & (ClientUpdateMaskType(1) << (index % CLIENT_UPDATE_MASK_BITS))) != 0; }
 
         void AppendToPacket(ByteBuffer* data)
         {
             for (uint32 i = 0; i < GetBlockCount(); ++i)
-            {
-                ClientUpdateMaskType maskPart = 0;
-                for (uint32 j = 0; j < CLIENT_UPDATE_MASK_BITS; ++j)
-                    if (_bits[CLIENT_UPDATE_MASK_BITS * i + j])
-                        maskPart |= 1 << j;
-
-                *data << maskPart;
-            }
+                *data << _bits[i];
         }
 
         uint32 GetBlockCount() const { return _blockCount; }
@@ -71,14 +65,14 @@ class UpdateMask
             _fieldCount = valuesCount;
             _blockCount = (valuesCount + CLIENT_UPDATE_MASK_BITS - 1) / CLIENT_UPDATE_MASK_BITS;
 
-            _bits = new uint8[_blockCount * CLIENT_UPDATE_MASK_BITS];
-            memset(_bits, 0, sizeof(uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
+            _bits = new ClientUpdateMaskType[_blockCount];
+            memset(_bits, 0, sizeof(ClientUpdateMaskType) * _blockCount);
         }
 
         void Clear()
         {
             if (_bits)
-                memset(_bits, 0, sizeof(uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
+                memset(_bits, 0, sizeof(ClientUpdateMaskType) * _blockCount);
         }
 
         UpdateMask& operator=(UpdateMask const& right)
@@ -87,14 +81,14 @@ class UpdateMask
                 return *this;
 
             SetCount(right.GetCount());
-            memcpy(_bits, right._bits, sizeof(uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
+            memcpy(_bits, right._bits, sizeof(ClientUpdateMaskType) * _blockCount);
             return *this;
         }
 
         UpdateMask& operator&=(UpdateMask const& right)
         {
             ASSERT(right.GetCount() <= GetCount());
-            for (uint32 i = 0; i < _fieldCount; ++i)
+            for (uint32 i = 0; i < right._blockCount; ++i)
                 _bits[i] &= right._bits[i];
 
             return *this;
@@ -103,7 +97,7 @@ class UpdateMask
         UpdateMask& operator|=(UpdateMask const& right)
         {
             ASSERT(right.GetCount() <= GetCount());
-            for (uint32 i = 0; i < _fieldCount; ++i)
+            for (uint32 i = 0; i < right._blockCount; ++i)
                 _bits[i] |= right._bits[i];
 
             return *this;
@@ -119,7 +113,7 @@ class UpdateMask
     private:
         uint32 _fieldCount;
         uint32 _blockCount;
-        uint8* _bits;
+        ClientUpdateMaskType* _bits;
 };
 
 #endif
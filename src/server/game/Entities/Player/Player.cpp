@@ -32,6 +32,7 @@
 #include "QuestDef.h"
 #include "GossipDef.h"
 #include "UpdateData.h"
+#include "zlib.h"
 #include "Channel.h"
 #include "ChannelMgr.h"
 #include "MapManager.h"
@@ -672,6 +673,8 @@ Player::Player(WorldSession* session) : Unit(true), m_achievementMgr(this), m_re
 
     m_speakTime = 0;
     m_speakCount = 0;
+    m_localChatTokens = 0;
+    m_localChatTime = 0;
 
     m_itemLevelSum = 0.f;
     m_wearingOffhand = false;
@@ -714,6 +717,9 @@ Player::Player(WorldSession* session) : Unit(true), m_achievementMgr(this), m_re
     m_areaUpdateId = 0;
 
     m_nextSave = sWorld->getIntConfig(CONFIG_INTERVAL_SAVE);
+    m_gridEntryIndex = 0;
+    m_visibilityCreates = 0;
+    m_visibilityCreatesDeferred = false;
 
     clearResurrectRequestData();
 
@@ -882,6 +888,8 @@ Player::Player(WorldSession* session) : Unit(true), m_achievementMgr(this), m_re
     m_lastFallTime = 0;
     m_lastFallZ = 0;
 
+    m_queuedMovementRelayCount = 0;
+
     m_grantableLevels = 0;
 
     m_ControlledByPlayer = true;
@@ -1568,6 +1576,14 @@ void Player::Update(uint32 p_time)
     if (!IsInWorld())
         return;
 
+    m_visibilityCreates = 0;
+    if (m_visibilityCreatesDeferred)
+    {
+        m_visibilityCreatesDeferred = false;
+        // right away, a relocation notify would wait for Visibility.Notify.Period
+        UpdateVisibilityForPlayer();
+    }
+
     // undelivered mail
     if (sWorld->getIntConfig(CONFIG_CORE_TYPE) <= NODE_TYPE_MASTER)
         if (m_nextMailDelivereTime && m_nextMailDelivereTime <= time(NULL))
@@ -6959,8 +6975,8 @@ void Player::SendMessageToSet(WorldPacket* data, Player const* skipped_rcvr)
 
     // we use World::GetMaxVisibleDistance() because i cannot see why not use a distance
     // update: replaced by GetMap()->GetVisibilityDistance()
-    Trinity::MessageDistDeliverer notifier(this, data, GetVisibilityRange(), false, skipped_rcvr);
-    VisitNearbyWorldObject(GetVisibilityRange(), notifier);
+    Trinity::MessageDistDeliverer notifier(this, data, GetClientVisibilityRange(), false, skipped_rcvr);
+    VisitNearbyWorldObject(GetClientVisibilityRange(), notifier);
 }
 
 void Player::SendDirectMessage(WorldPacket* data)
@@ -6968,6 +6984,70 @@ void Player::SendDirectMessage(WorldPacket* data)
     m_session->SendPacket(data);
 }
 
+// SMSG_MULTIPLE_MOVES holds packets as uint8 size (opcode included), uint16 opcode and the packet data
+#define MAX_QUEUED_MOVEMENT_RELAYS_SIZE 0x7FFF
+
+void Player::QueueMovementRelay(WorldPacket const* data)
+{
+    size_t size = sizeof(uint16) + data->size();
+    if (size > 0xFF)
+    {
+        // too large to be embedded, keep the order of the already queued ones
+        SendQueuedMovementRelays();
+        m_session->SendPacket(data);
+        return;
+    }
+
+    if (m_queuedMovementRelays.size() + 1 + size > MAX_QUEUED_MOVEMENT_RELAYS_SIZE)
+        SendQueuedMovementRelays();
+
+    m_queuedMovementRelays << uint8(size);
+    m_queuedMovementRelays << uint16(data->GetOpcode());
+    m_queuedMovementRelays.append(data->contents(), data->size());
+    ++m_queuedMovementRelayCount;
+}
+
+void Player::SendQueuedMovementRelays()
+{
+    if (!m_queuedMovementRelayCount)
+        return;
+
+    WorldPacket data;
+    if (m_queuedMovementRelayCount == 1)
+    {
+        // nothing to batch with, send the packet as it was relayed
+        size_t size = m_queuedMovementRelays.size() - 1 - sizeof(uint16);
+        data.Initialize(m_queuedMovementRelays.read<uint16>(1), size);
+        data.append(m_queuedMovementRelays.contents() + 1 + sizeof(uint16), size);
+    }
+    else
+    {
+        uint32 compressSize = sWorld->getIntConfig(CONFIG_MOVEMENT_BATCHING_COMPRESS_SIZE);
+        if (compressSize && m_queuedMovementRelays.size() >= compressSize)
+        {
+            uint32 destSize = compressBound(m_queuedMovementRelays.size());
+            data.Initialize(SMSG_COMPRESSED_MOVES, destSize + sizeof(uint32));
+            data.resize(destSize + sizeof(uint32));
+            data.put<uint32>(0, m_queuedMovementRelays.size());
+            UpdateData::Compress(const_cast<uint8*>(data.contents()) + sizeof(uint32), &destSize,
+                (void*)m_queuedMovementRelays.contents(), m_queuedMovementRelays.size());
+            data.resize(destSize ? destSize + sizeof(uint32) : 0);
+        }
+
+        // compression disabled or failed
+        if (data.empty())
+        {
+            data.Initialize(SMSG_MULTIPLE_MOVES, m_queuedMovementRelays.size());
+            data.append(m_queuedMovementRelays);
+        }
+    }
+
+    m_session->SendPacket(&data);
+    sWorld->AddBatchedMovementPacket(m_queuedMovementRelayCount, data.size());
+
+    ClearQueuedMovementRelays();
+}
+
 void Player::SendCinematicStart(uint32 CinematicSequenceId)
 {
     WorldPacket data(SMSG_TRIGGER_CINEMATIC, 4);
@@ -20021,6 +20101,35 @@ bool Player::CanSpeak() const
     return  GetSession()->m_muteTime <= time (NULL);
 }
 
+// Token bucket for say/yell/emote: refills at ChatFlood.LocalMessageRate per second up to
+// ChatFlood.LocalMessageBurst messages, each message sent to the area takes one.
+bool Player::CanSendLocalChat()
+{
+    uint32 rate = sWorld->getIntConfig(CONFIG_CHATFLOOD_LOCAL_RATE);
+    if (!rate || !AccountMgr::IsVIPorPlayer(GetSession()->GetSecurity()))
+        return true;
+
+    uint32 const burst = sWorld->getIntConfig(CONFIG_CHATFLOOD_LOCAL_BURST) * IN_MILLISECONDS;
+    uint32 now = getMSTime();
+    if (!m_localChatTime)
+        m_localChatTokens = burst;
+    else
+    {
+        uint64 refill = uint64(getMSTimeDiff(m_localChatTime, now)) * rate + m_localChatTokens;
+        m_localChatTokens = uint32(std::min<uint64>(refill, burst));
+    }
+    m_localChatTime = now ? now : 1;
+
+    if (m_localChatTokens < IN_MILLISECONDS)
+    {
+        sWorld->IncreaseDroppedLocalChatCount();
+        return false;
+    }
+
+    m_localChatTokens -= IN_MILLISECONDS;
+    return true;
+}
+
 /*********************************************************/
 /***              LOW LEVEL FUNCTIONS:Notifiers        ***/
 /*********************************************************/
@@ -22276,6 +22385,7 @@ void Player::UpdateVisibilityOf(WorldObject* target)
 
             target->DestroyForPlayer(this);
             m_clientGUIDs.erase(target->GetGUID());
+            sWorld->AddVisibilityDestroys(1);
 
 #ifdef TRINITY_DEBUG
             sLog->outDebug(LOG_FILTER_MAPS, "Object %u (Type: %u) out of range for player %u. Distance = %f", target->GetGUIDLow(), target->GetTypeId(), GetGUIDLow(), GetDistance(target));
@@ -22284,13 +22394,17 @@ void Player::UpdateVisibilityOf(WorldObject* target)
     }
     else
     {
-        if (canSeeOrDetect(target, false, true))
+        if (canSeeOrDetect(target, false, true) && CanCreateVisibleObject(target))
         {
             //if (target->isType(TYPEMASK_UNIT) && ((Unit*)target)->m_Vehicle)
             //    UpdateVisibilityOf(((Unit*)target)->m_Vehicle);
 
             target->SendUpdateToPlayer(this);
             m_clientGUIDs.insert(target->GetGUID());
+            sWorld->IncreaseVisibilityCreateCount();
+
+            if (target->GetTypeId() == TYPEID_UNIT)
+                target->ToCreature()->WakeUp();
 
 #ifdef TRINITY_DEBUG
             sLog->outDebug(LOG_FILTER_MAPS, "Object %u (Type: %u) is visible now for player %u. Distance = %f", target->GetGUIDLow(), target->GetTypeId(), GetGUIDLow(), GetDistance(target));
@@ -22304,6 +22418,39 @@ void Player::UpdateVisibilityOf(WorldObject* target)
     }
 }
 
+bool Player::CanCreateVisibleObject(WorldObject const* target)
+{
+    uint32 limit = sWorld->getIntConfig(CONFIG_VISIBILITY_CREATES_PER_UPDATE);
+    if (!limit)
+        return true;
+
+    // other players, our own units, vehicle and transport are always created right away
+    switch (target->GetTypeId())
+    {
+        case TYPEID_UNIT:
+            if (target == GetVehicleBase() || ((Unit const*)target)->GetCharmerOrOwnerGUID() == GetGUID())
+                return true;
+            break;
+        case TYPEID_GAMEOBJECT:
+            if (target == GetTransport())
+                return true;
+            break;
+        default:
+            return true;
+    }
+
+    if (m_visibilityCreates < limit)
+    {
+        ++m_visibilityCreates;
+        return true;
+    }
+
+    // created by the visibility update of the next Player::Update
+    m_visibilityCreatesDeferred = true;
+    sWorld->IncreaseDeferredVisibilityCreateCount();
+    return false;
+}
+
 void Player::UpdateTriggerVisibility()
 {
     if (m_clientGUIDs.empty())
@@ -22351,6 +22498,7 @@ void Player::UpdateVisibilityOf(T* target, UpdateData& data, std::set<Unit*>& vi
 
             target->BuildOutOfRangeUpdateBlock(&data);
             m_clientGUIDs.erase(target->GetGUID());
+            sWorld->AddVisibilityDestroys(1);
 
 #ifdef TRINITY_DEBUG
             sLog->outDebug(LOG_FILTER_MAPS, "Object %u (Type: %u, Entry: %u) is out of range for player %u. Distance = %f", target->GetGUIDLow(), target->GetTypeId(), target->GetEntry(), GetGUIDLow(), GetDistance(target));
@@ -22359,13 +22507,17 @@ void Player::UpdateVisibilityOf(T* target, UpdateData& data, std::set<Unit*>& vi
     }
     else //if (visibleNow.size() < 30 || target->GetTypeId() == TYPEID_UNIT && target->ToCreature()->IsVehicle())
     {
-        if (canSeeOrDetect(target, false, true))
+        if (canSeeOrDetect(target, false, true) && CanCreateVisibleObject(target))
         {
             //if (target->isType(TYPEMASK_UNIT) && ((Unit*)target)->m_Vehicle)
             //    UpdateVisibilityOf(((Unit*)target)->m_Vehicle, data, visibleNow);
 
             target->BuildCreateUpdateBlockForPlayer(&data, this);
             UpdateVisibilityOf_helper(m_clientGUIDs, target, visibleNow);
+            sWorld->IncreaseVisibilityCreateCount();
+
+            if (target->GetTypeId() == TYPEID_UNIT)
+                target->ToCreature()->WakeUp();
 
 #ifdef TRINITY_DEBUG
             sLog->outDebug(LOG_FILTER_MAPS, "Object %u (Type: %u, Entry: %u) is visible now for player %u. Distance = %f", target->GetGUIDLow(), target->GetTypeId(), target->GetEntry(), GetGUIDLow(), GetDistance(target));
@@ -22395,7 +22547,7 @@ void Player::UpdateVisibilityForPlayer()
 {
     // updates visibility of all objects around point of view for current player
     Trinity::VisibleNotifier notifier(*this);
-    m_seer->VisitNearbyObject(GetSightRange(), notifier);
+    m_seer->VisitNearbyObject(GetSightRange() + sWorld->getFloatConfig(CONFIG_VISIBILITY_LEAVE_MARGIN), notifier);
     notifier.SendToSelf();   // send gathered data
 }
 
@@ -23984,6 +24136,43 @@ void Player::StopCastingBindSight()
     }
 }
 
+void GridObjectEntries<Player>::AddEntry(Player* player)
+{
+    player->SetGridEntryIndex(uint32(_entries.size()));
+    _entries.push_back(PlayerGridEntry());
+    _entries.back().Target = player;
+    UpdateEntry(player);
+}
+
+void GridObjectEntries<Player>::RemoveEntry(Player* player)
+{
+    uint32 index = player->GetGridEntryIndex();
+    ASSERT(index < _entries.size() && _entries[index].Target == player);
+
+    // fill the gap with the last entry, the order of the players in a cell does not matter
+    if (index + 1 < _entries.size())
+    {
+        _entries[index] = _entries.back();
+        _entries[index].Target->SetGridEntryIndex(index);
+    }
+    _entries.pop_back();
+}
+
+void GridObjectEntries<Player>::UpdateEntry(Player* player)
+{
+    PlayerGridEntry& entry = _entries[player->GetGridEntryIndex()];
+    entry.X = player->GetPositionX();
+    entry.Y = player->GetPositionY();
+    entry.Z = player->GetPositionZ();
+    entry.PhaseMask = player->GetPhaseMask();
+}
+
+void Player::UpdateGridEntry()
+{
+    if (IsInGrid())
+        GetGridRefManager()->UpdateEntry(this);
+}
+
 void Player::SetViewpoint(WorldObject* target, bool apply)
 {
     if (apply)
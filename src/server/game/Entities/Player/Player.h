@@ -1971,7 +1971,7 @@ class Player : public Unit, public GridObject<Player>
         bool UpdatePosition(const Position &pos, bool teleport = false) { return UpdatePosition(pos.GetPositionX(), pos.GetPositionY(), pos.GetPositionZ(), pos.GetOrientation(), teleport); }
         void UpdateUnderwaterState(Map* m, float x, float y, float z);
 
-        void SendMessageToSet(WorldPacket* data, bool self) {SendMessageToSetInRange(data, GetVisibilityRange(), self); };// overwrite Object::SendMessageToSet
+        void SendMessageToSet(WorldPacket* data, bool self) {SendMessageToSetInRange(data, GetClientVisibilityRange(), self); };// overwrite Object::SendMessageToSet
         void SendMessageToSetInRange(WorldPacket* data, float fist, bool self);// overwrite Object::SendMessageToSetInRange
         void SendMessageToSetInRange(WorldPacket* data, float dist, bool self, bool own_team_only);
         void SendMessageToSet(WorldPacket* data, Player const* skipped_rcvr);
@@ -2147,6 +2147,9 @@ class Player : public Unit, public GridObject<Player>
         void SendInitWorldStates(uint32 zone, uint32 area);
         void SendUpdateWorldState(uint32 Field, uint32 Value);
         void SendDirectMessage(WorldPacket* data);
+        void QueueMovementRelay(WorldPacket const* data);
+        void SendQueuedMovementRelays();
+        void ClearQueuedMovementRelays() { m_queuedMovementRelays.clear(); m_queuedMovementRelayCount = 0; }
         void SendBGWeekendWorldStates();
         void SendBattlefieldWorldStates();
 
@@ -2312,6 +2315,7 @@ class Player : public Unit, public GridObject<Player>
 
         void UpdateSpeakTime();
         bool CanSpeak() const;
+        bool CanSendLocalChat();
         void ChangeSpeakTime(int utime);
 
         /*********************************************************/
@@ -2343,6 +2347,11 @@ class Player : public Unit, public GridObject<Player>
         bool SetHover(bool enable);
 
         void SetSeer(WorldObject* target) { m_seer = target; }
+
+        // position of the player in the entry array of its cell, see GridObjectEntries<Player>
+        uint32 GetGridEntryIndex() const { return m_gridEntryIndex; }
+        void SetGridEntryIndex(uint32 index) { m_gridEntryIndex = index; }
+        void UpdateGridEntry();
         void SetViewpoint(WorldObject* target, bool apply);
         WorldObject* GetViewpoint() const;
         void StopCastingCharm();
@@ -2375,6 +2384,8 @@ class Player : public Unit, public GridObject<Player>
         ClientGUIDs m_clientGUIDs;
 
         bool HaveAtClient(WorldObject const* u) const { return u == this || m_clientGUIDs.find(u->GetGUID()) != m_clientGUIDs.end(); }
+        // counts the creation against Visibility.CreatesPerUpdate, false if it has to wait for a later update
+        bool CanCreateVisibleObject(WorldObject const* target);
 
         bool IsNeverVisible() const;
 
@@ -2736,8 +2747,13 @@ class Player : public Unit, public GridObject<Player>
 
         uint32 m_team;
         uint32 m_nextSave;
+        uint32 m_gridEntryIndex;
+        uint32 m_visibilityCreates;                         // objects created at the client in this update
+        bool m_visibilityCreatesDeferred;
         time_t m_speakTime;
         uint32 m_speakCount;
+        uint32 m_localChatTokens;                           // in 1/1000 of a message
+        uint32 m_localChatTime;
         Difficulty m_dungeonDifficulty;
         Difficulty m_raidDifficulty;
         Difficulty m_raidMapDifficulty;
@@ -2922,6 +2938,10 @@ class Player : public Unit, public GridObject<Player>
         uint32 m_lastFallTime;
         float  m_lastFallZ;
 
+        // movement packets of nearby units waiting for the end of the map update, see Movement.Batching
+        ByteBuffer m_queuedMovementRelays;
+        uint32 m_queuedMovementRelayCount;
+
         int32 m_MirrorTimer[MAX_TIMERS];
         uint8 m_MirrorTimerFlags;
         uint8 m_MirrorTimerFlagsLast;
@@ -49,6 +49,7 @@ Transport::~Transport()
 bool Transport::Create(uint32 guidlow, uint32 entry, uint32 mapid, float x, float y, float z, float ang, uint32 animprogress)
 {
     Relocate(x, y, z, ang);
+    _lastPassengerVisibilityPos.Relocate(x, y, z, ang);
 
     if (!IsPositionValid())
     {
@@ -502,7 +503,12 @@ void Transport::UpdatePosition(float x, float y, float z, float o)
     Relocate(x, y, z, o);
     UpdateModelPosition();
 
-    UpdatePassengerPositions(_passengers);
+    // passengers crossing a cell always update their visibility through the map relocation
+    bool updateVisibility = GetExactDistSq(&_lastPassengerVisibilityPos) >= passengerVisibilityUpdateDistance * passengerVisibilityUpdateDistance;
+    if (updateVisibility)
+        _lastPassengerVisibilityPos.Relocate(x, y, z, o);
+
+    UpdatePassengerPositions(_passengers, updateVisibility);
 
     /* There are four possible scenarios that trigger loading/unloading passengers:
     1. transport moves from inactive to active grid
@@ -515,7 +521,7 @@ void Transport::UpdatePosition(float x, float y, float z, float o)
     else if (!_staticPassengers.empty() && !newActive && oldCell.DiffGrid(Cell(GetPositionX(), GetPositionY()))) // 3.
         UnloadStaticPassengers();
     else
-        UpdatePassengerPositions(_staticPassengers);
+        UpdatePassengerPositions(_staticPassengers, updateVisibility);
     // 4. is handed by grid unload
 }
 
@@ -685,7 +691,7 @@ bool Transport::TeleportTransport(uint32 newMapid, float x, float y, float z, fl
     }
 }
 
-void Transport::UpdatePassengerPositions(PassengerSet& passengers)
+void Transport::UpdatePassengerPositions(PassengerSet& passengers, bool updateVisibility)
 {
     for (PassengerSet::iterator itr = passengers.begin(); itr != passengers.end(); ++itr)
     {
@@ -714,7 +720,7 @@ void Transport::UpdatePassengerPositions(PassengerSet& passengers)
             case TYPEID_UNIT:
             {
                 Creature* creature = passenger->ToCreature();
-                GetMap()->CreatureRelocation(creature, x, y, z, o, false);
+                GetMap()->CreatureRelocation(creature, x, y, z, o, false, updateVisibility);
                 creature->GetTransportHomePosition(x, y, z, o);
                 CalculatePassengerPosition(x, y, z, o);
                 creature->SetHomePosition(x, y, z, o);
@@ -722,13 +728,13 @@ void Transport::UpdatePassengerPositions(PassengerSet& passengers)
             }
             case TYPEID_PLAYER:
                 if (passenger->IsInWorld())
-                    GetMap()->PlayerRelocation(passenger->ToPlayer(), x, y, z, o);
+                    GetMap()->PlayerRelocation(passenger->ToPlayer(), x, y, z, o, updateVisibility);
                 break;
             case TYPEID_GAMEOBJECT:
-                GetMap()->GameObjectRelocation(passenger->ToGameObject(), x, y, z, o, false);
+                GetMap()->GameObjectRelocation(passenger->ToGameObject(), x, y, z, o, false, updateVisibility);
                 break;
             case TYPEID_DYNAMICOBJECT:
-                GetMap()->DynamicObjectRelocation(passenger->ToDynObject(), x, y, z, o);
+                GetMap()->DynamicObjectRelocation(passenger->ToDynObject(), x, y, z, o, updateVisibility);
                 break;
             default:
                 break;
@@ -754,6 +760,14 @@ void Transport::SetMoving(bool val)
 {
     _isMoving = val;
 
+    // catch up on the visibility updates skipped since the last one when stopping
+    if (!val && GetExactDistSq(&_lastPassengerVisibilityPos) > 0.0f)
+    {
+        _lastPassengerVisibilityPos.Relocate(this);
+        UpdatePassengerPositions(_passengers, true);
+        UpdatePassengerPositions(_staticPassengers, true);
+    }
+
     EnablePassengerMovement(_staticPassengers, val);
     EnablePassengerMovement(_passengers, val);
 }
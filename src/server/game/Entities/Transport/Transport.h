@@ -25,6 +25,8 @@
 
 
 uint32 const positionUpdateDelay = 200;
+// passengers move along with the transport, so their visibility only changes noticeably after it travelled this far
+float const passengerVisibilityUpdateDistance = 10.0f;
 
 struct CreatureData;
 
@@ -126,7 +128,7 @@ class Transport : public GameObject, public TransportBase
     bool TeleportTransport(uint32 newMapid, float x, float y, float z, float o);
 
     void EnablePassengerMovement(PassengerSet& passengers, bool enabled);
-    void UpdatePassengerPositions(PassengerSet& passengers);
+    void UpdatePassengerPositions(PassengerSet& passengers, bool updateVisibility);
 
     void DoEventIfAny(KeyFrame const& node, bool departure);
 
@@ -149,6 +151,7 @@ class Transport : public GameObject, public TransportBase
     PassengerSet _passengers;
     PassengerSet::iterator _passengerTeleportItr;
     PassengerSet _staticPassengers;
+    Position _lastPassengerVisibilityPos;   // transport position when passenger visibility was last updated
 
     bool _delayedAddModel;
 };
@@ -17615,6 +17615,9 @@ void Unit::SetPhaseMask(uint32 newPhaseMask, bool update)
 
     WorldObject::SetPhaseMask(newPhaseMask, update);
 
+    if (Player* player = ToPlayer())
+        player->UpdateGridEntry();
+
     if (!IsInWorld())
         return;
 
@@ -18371,6 +18374,8 @@ void Unit::UpdateOrientation(float orientation)
 void Unit::UpdateHeight(float newZ)
 {
     Relocate(GetPositionX(), GetPositionY(), newZ);
+    if (Player* player = ToPlayer())
+        player->UpdateGridEntry();
     if (IsVehicle())
         GetVehicleKit()->RelocatePassengers(GetPositionX(), GetPositionY(), newZ, GetOrientation());
 }
@@ -18705,11 +18710,6 @@ void Unit::_BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target
     if (!target)
         return;
 
-    ByteBuffer fieldBuffer;
-
-    UpdateMask updateMask;
-    updateMask.SetCount(m_valuesCount);
-
     uint32* flags = UnitUpdateFieldFlags;
     uint32 visibleFlag = UF_FLAG_PUBLIC;
 
@@ -18727,7 +18727,29 @@ void Unit::_BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target
     if (plr && plr->IsInSameRaidWith(target))
         visibleFlag |= UF_FLAG_PARTY_MEMBER;
 
-    Creature const* creature = ToCreature();
+    // the fields sent only depend on visibleFlag unless special info or per caster aura states are involved,
+    // so receivers with the same flags share the block and only get the per target fields rewritten
+    bool shareable = updateType == UPDATETYPE_VALUES && _sharedValuesUpdates && !(visibleFlag & UF_FLAG_SPECIAL_INFO) &&
+        !HasFlag(UNIT_FIELD_AURASTATE, PER_CASTER_AURA_STATE_MASK);
+
+    if (shareable)
+    {
+        if (SharedValuesUpdate const* shared = _FindSharedValuesUpdate(visibleFlag))
+        {
+            size_t start = data->wpos();
+            data->append(shared->Block);
+            for (std::vector<std::pair<uint32, uint16> >::const_iterator itr = shared->TargetFields.begin(); itr != shared->TargetFields.end(); ++itr)
+                data->put<uint32>(start + itr->first, _GetValuesUpdateField(itr->second, target));
+            return;
+        }
+    }
+
+    ByteBuffer fieldBuffer;
+
+    UpdateMask updateMask;
+    updateMask.SetCount(m_valuesCount);
+
+    std::vector<std::pair<uint32, uint16> > targetFields;
     for (uint16 index = 0; index < m_valuesCount; ++index)
     {
         if (_fieldNotifyFlags & flags[index] ||
@@ -18737,147 +18759,184 @@ void Unit::_BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target
         {
             updateMask.SetBit(index);
 
-            if (index == UNIT_NPC_FLAGS)
-            {
-                uint32 appendValue = m_uint32Values[UNIT_NPC_FLAGS];
+            if (shareable && IsTargetDependentValuesUpdateField(index))
+                targetFields.push_back(std::make_pair(uint32(fieldBuffer.wpos()), index));
 
-                if (creature)
-                    if (!target->canSeeSpellClickOn(creature))
-                        appendValue &= ~UNIT_NPC_FLAG_SPELLCLICK;
+            fieldBuffer << _GetValuesUpdateField(index, target);
+        }
+    }
 
-                fieldBuffer << uint32(appendValue);
-            }
-            else if (index == UNIT_FIELD_AURASTATE)
-            {
-                // Check per caster aura states to not enable using a spell in client if specified aura is not by target
-                fieldBuffer << BuildAuraStateUpdateForTarget(target);
-            }
-            // FIXME: Some values at server stored in float format but must be sent to client in uint32 format
-            else if (index >= UNIT_FIELD_BASEATTACKTIME && index <= UNIT_FIELD_RANGEDATTACKTIME)
-            {
-                // convert from float to uint32 and send
-                fieldBuffer << uint32(m_floatValues[index] < 0 ? 0 : m_floatValues[index]);
-            }
-            // there are some float values which may be negative or can't get negative due to other checks
-            else if ((index >= UNIT_FIELD_NEGSTAT0   && index <= UNIT_FIELD_NEGSTAT4) ||
-                     (index >= UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE  && index <= (UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE + 6)) ||
-                     (index >= UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE  && index <= (UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE + 6)) ||
-                     (index >= UNIT_FIELD_POSSTAT0   && index <= UNIT_FIELD_POSSTAT4))
-            {
-                fieldBuffer << uint32(m_floatValues[index]);
-            }
-            // Gamemasters should be always able to select units - remove not selectable flag
-            else if (index == UNIT_FIELD_FLAGS)
-            {
-                uint32 appendValue = m_uint32Values[UNIT_FIELD_FLAGS];
-                if (target->isGameMaster() || target->isDeveloper())
-                    appendValue &= ~UNIT_FLAG_NOT_SELECTABLE;
+    size_t start = data->wpos();
+    *data << uint8(updateMask.GetBlockCount());
+    updateMask.AppendToPacket(data);
+    size_t fieldsStart = data->wpos() - start;
+    data->append(fieldBuffer);
 
-                fieldBuffer << uint32(appendValue);
-            }
-            // use modelid_a if not gm, _h if gm for CREATURE_FLAG_EXTRA_TRIGGER creatures
-            else if (index == UNIT_FIELD_DISPLAYID)
-            {
-                uint32 displayId = m_uint32Values[UNIT_FIELD_DISPLAYID];
-                if (creature)
-                {
-                    CreatureTemplate const* cinfo = creature->GetCreatureTemplate();
+    if (shareable)
+    {
+        SharedValuesUpdate& shared = _AddSharedValuesUpdate(visibleFlag);
+        shared.Block.append(data->contents() + start, data->wpos() - start);
+        for (std::vector<std::pair<uint32, uint16> >::const_iterator itr = targetFields.begin(); itr != targetFields.end(); ++itr)
+            shared.TargetFields.push_back(std::make_pair(uint32(fieldsStart + itr->first), itr->second));
+    }
+}
 
-                    // this also applies for transform auras
-                    if (SpellInfo const* transform = sSpellMgr->GetSpellInfo(getTransForm()))
-                        for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
-                            if (transform->Effects[i].IsAura(SPELL_AURA_TRANSFORM))
-                                if (CreatureTemplate const* transformInfo = sObjectMgr->GetCreatureTemplate(transform->Effects[i].MiscValue))
-                                {
-                        cinfo = transformInfo;
-                        break;
-                                }
+bool Unit::IsTargetDependentValuesUpdateField(uint16 index)
+{
+    switch (index)
+    {
+        case UNIT_NPC_FLAGS:
+        case UNIT_FIELD_AURASTATE:
+        case UNIT_FIELD_FLAGS:
+        case UNIT_FIELD_DISPLAYID:
+        case UNIT_DYNAMIC_FLAGS:
+        case UNIT_FIELD_BYTES_2:
+        case UNIT_FIELD_FACTIONTEMPLATE:
+            return true;
+        default:
+            return false;
+    }
+}
 
-                    if (cinfo->flags_extra & CREATURE_FLAG_EXTRA_TRIGGER)
-                    {
-                        if (target->isGameMaster() || target->isDeveloper())
-                        {
-                            if (cinfo->Modelid1)
-                                displayId = cinfo->Modelid1;    // Modelid1 is a visible model for gms
-                            else
-                                displayId = 17519;              // world visible trigger's model
-                        }
-                        else
-                        {
-                            if (cinfo->Modelid2)
-                                displayId = cinfo->Modelid2;    // Modelid2 is an invisible model for players
-                            else
-                                displayId = 11686;              // world invisible trigger's model
-                        }
-                    }
-                }
+// value of a field as sent to target, the fields rewritten here must be listed in IsTargetDependentValuesUpdateField
+uint32 Unit::_GetValuesUpdateField(uint16 index, Player* target) const
+{
+    Creature const* creature = ToCreature();
+    if (index == UNIT_NPC_FLAGS)
+    {
+        uint32 appendValue = m_uint32Values[UNIT_NPC_FLAGS];
 
-                fieldBuffer << uint32(displayId);
-            }
-            // hide lootable animation for unallowed players
-            else if (index == UNIT_DYNAMIC_FLAGS)
-            {
-                uint32 dynamicFlags = m_uint32Values[UNIT_DYNAMIC_FLAGS] & ~(UNIT_DYNFLAG_TAPPED | UNIT_DYNFLAG_TAPPED_BY_PLAYER);
+        if (creature)
+            if (!target->canSeeSpellClickOn(creature))
+                appendValue &= ~UNIT_NPC_FLAG_SPELLCLICK;
 
-                if (creature)
-                {
-                    if (creature->hasLootRecipient())
-                    {
-                        dynamicFlags |= UNIT_DYNFLAG_TAPPED;
-                        if (creature->isTappedBy(target))
-                            dynamicFlags |= UNIT_DYNFLAG_TAPPED_BY_PLAYER;
-                    }
+        return uint32(appendValue);
+    }
+    else if (index == UNIT_FIELD_AURASTATE)
+    {
+        // Check per caster aura states to not enable using a spell in client if specified aura is not by target
+        return BuildAuraStateUpdateForTarget(target);
+    }
+    // FIXME: Some values at server stored in float format but must be sent to client in uint32 format
+    else if (index >= UNIT_FIELD_BASEATTACKTIME && index <= UNIT_FIELD_RANGEDATTACKTIME)
+    {
+        // convert from float to uint32 and send
+        return uint32(m_floatValues[index] < 0 ? 0 : m_floatValues[index]);
+    }
+    // there are some float values which may be negative or can't get negative due to other checks
+    else if ((index >= UNIT_FIELD_NEGSTAT0   && index <= UNIT_FIELD_NEGSTAT4) ||
+             (index >= UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE  && index <= (UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE + 6)) ||
+             (index >= UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE  && index <= (UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE + 6)) ||
+             (index >= UNIT_FIELD_POSSTAT0   && index <= UNIT_FIELD_POSSTAT4))
+    {
+        return uint32(m_floatValues[index]);
+    }
+    // Gamemasters should be always able to select units - remove not selectable flag
+    else if (index == UNIT_FIELD_FLAGS)
+    {
+        uint32 appendValue = m_uint32Values[UNIT_FIELD_FLAGS];
+        if (target->isGameMaster() || target->isDeveloper())
+            appendValue &= ~UNIT_FLAG_NOT_SELECTABLE;
 
-                    if (!target->isAllowedToLoot(creature))
-                        dynamicFlags &= ~UNIT_DYNFLAG_LOOTABLE;
-                }
+        return uint32(appendValue);
+    }
+    // use modelid_a if not gm, _h if gm for CREATURE_FLAG_EXTRA_TRIGGER creatures
+    else if (index == UNIT_FIELD_DISPLAYID)
+    {
+        uint32 displayId = m_uint32Values[UNIT_FIELD_DISPLAYID];
+        if (creature)
+        {
+            CreatureTemplate const* cinfo = creature->GetCreatureTemplate();
 
-                // unit UNIT_DYNFLAG_TRACK_UNIT should only be sent to caster of SPELL_AURA_MOD_STALKED auras
-                if (dynamicFlags & UNIT_DYNFLAG_TRACK_UNIT)
-                    if (!HasAuraTypeWithCaster(SPELL_AURA_MOD_STALKED, target->GetGUID()))
-                        dynamicFlags &= ~UNIT_DYNFLAG_TRACK_UNIT;
+            // this also applies for transform auras
+            if (SpellInfo const* transform = sSpellMgr->GetSpellInfo(getTransForm()))
+                for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
+                    if (transform->Effects[i].IsAura(SPELL_AURA_TRANSFORM))
+                        if (CreatureTemplate const* transformInfo = sObjectMgr->GetCreatureTemplate(transform->Effects[i].MiscValue))
+                        {
+                cinfo = transformInfo;
+                break;
+                        }
 
-                fieldBuffer << dynamicFlags;
-            }
-            // FG: pretend that OTHER players in own group are friendly ("blue")
-            else if (index == UNIT_FIELD_BYTES_2 || index == UNIT_FIELD_FACTIONTEMPLATE)
+            if (cinfo->flags_extra & CREATURE_FLAG_EXTRA_TRIGGER)
             {
-                const Player* pPlayer = ToPlayer();
-
-                if (IsControlledByPlayer() && target != this && IsInRaidWith(target)
-                    && sWorld->getBoolConfig(CONFIG_ALLOW_TWO_SIDE_INTERACTION_GROUP))
+                if (target->isGameMaster() || target->isDeveloper())
                 {
-                    FactionTemplateEntry const* ft1 = getFactionTemplateEntry();
-                    FactionTemplateEntry const* ft2 = target->getFactionTemplateEntry();
-                    if (ft1 && ft2 && !ft1->IsFriendlyTo(*ft2))
-                    {
-                        if (index == UNIT_FIELD_BYTES_2)
-                            // Allow targetting opposite faction in party when enabled in config
-                            fieldBuffer << (m_uint32Values[UNIT_FIELD_BYTES_2] & ((UNIT_BYTE2_FLAG_SANCTUARY /*| UNIT_BYTE2_FLAG_AURAS | UNIT_BYTE2_FLAG_UNK5*/) << 8)); // this flag is at uint8 offset 1 !!
-                        else
-                            // pretend that all other HOSTILE players have own faction, to allow follow, heal, rezz (trade wont work)
-                            fieldBuffer << uint32(target->getFaction());
-                    }
+                    if (cinfo->Modelid1)
+                        displayId = cinfo->Modelid1;    // Modelid1 is a visible model for gms
                     else
-                        fieldBuffer << m_uint32Values[index];
+                        displayId = 17519;              // world visible trigger's model
                 }
-                else if (index == UNIT_FIELD_FACTIONTEMPLATE && target->HandleWithCrossFactionBG()) // BG Crossfaction handling
-                    fieldBuffer << Battleground::GetFactionForCrossfactionBG(target, (pPlayer || (GetOwner() && GetOwner()->GetTypeId() == TYPEID_PLAYER)) ? NULL : getFactionTemplateEntry(),
-                                                                                false, (GetOwner() && GetOwner()->GetTypeId() == TYPEID_PLAYER) ? GetAffectingPlayer() : pPlayer);
                 else
-                    fieldBuffer << m_uint32Values[index];
+                {
+                    if (cinfo->Modelid2)
+                        displayId = cinfo->Modelid2;    // Modelid2 is an invisible model for players
+                    else
+                        displayId = 11686;              // world invisible trigger's model
+                }
             }
-            else
+        }
+
+        return uint32(displayId);
+    }
+    // hide lootable animation for unallowed players
+    else if (index == UNIT_DYNAMIC_FLAGS)
+    {
+        uint32 dynamicFlags = m_uint32Values[UNIT_DYNAMIC_FLAGS] & ~(UNIT_DYNFLAG_TAPPED | UNIT_DYNFLAG_TAPPED_BY_PLAYER);
+
+        if (creature)
+        {
+            if (creature->hasLootRecipient())
             {
-                // send in current format (float as float, uint32 as uint32)
-                fieldBuffer << m_uint32Values[index];
+                dynamicFlags |= UNIT_DYNFLAG_TAPPED;
+                if (creature->isTappedBy(target))
+                    dynamicFlags |= UNIT_DYNFLAG_TAPPED_BY_PLAYER;
             }
+
+            if (!target->isAllowedToLoot(creature))
+                dynamicFlags &= ~UNIT_DYNFLAG_LOOTABLE;
         }
+
+        // unit UNIT_DYNFLAG_TRACK_UNIT should only be sent to caster of SPELL_AURA_MOD_STALKED auras
+        if (dynamicFlags & UNIT_DYNFLAG_TRACK_UNIT)
+            if (!HasAuraTypeWithCaster(SPELL_AURA_MOD_STALKED, target->GetGUID()))
+                dynamicFlags &= ~UNIT_DYNFLAG_TRACK_UNIT;
+
+        return dynamicFlags;
     }
+    // FG: pretend that OTHER players in own group are friendly ("blue")
+    else if (index == UNIT_FIELD_BYTES_2 || index == UNIT_FIELD_FACTIONTEMPLATE)
+    {
+        const Player* pPlayer = ToPlayer();
 
-    *data << uint8(updateMask.GetBlockCount());
-    updateMask.AppendToPacket(data);
-    data->append(fieldBuffer);
+        if (IsControlledByPlayer() && target != this && IsInRaidWith(target)
+            && sWorld->getBoolConfig(CONFIG_ALLOW_TWO_SIDE_INTERACTION_GROUP))
+        {
+            FactionTemplateEntry const* ft1 = getFactionTemplateEntry();
+            FactionTemplateEntry const* ft2 = target->getFactionTemplateEntry();
+            if (ft1 && ft2 && !ft1->IsFriendlyTo(*ft2))
+            {
+                if (index == UNIT_FIELD_BYTES_2)
+                    // Allow targetting opposite faction in party when enabled in config
+                    return (m_uint32Values[UNIT_FIELD_BYTES_2] & ((UNIT_BYTE2_FLAG_SANCTUARY /*| UNIT_BYTE2_FLAG_AURAS | UNIT_BYTE2_FLAG_UNK5*/) << 8)); // this flag is at uint8 offset 1 !!
+                else
+                    // pretend that all other HOSTILE players have own faction, to allow follow, heal, rezz (trade wont work)
+                    return uint32(target->getFaction());
+            }
+            else
+                return m_uint32Values[index];
+        }
+        else if (index == UNIT_FIELD_FACTIONTEMPLATE && target->HandleWithCrossFactionBG()) // BG Crossfaction handling
+            return Battleground::GetFactionForCrossfactionBG(target, (pPlayer || (GetOwner() && GetOwner()->GetTypeId() == TYPEID_PLAYER)) ? NULL : getFactionTemplateEntry(),
+                                                                        false, (GetOwner() && GetOwner()->GetTypeId() == TYPEID_PLAYER) ? GetAffectingPlayer() : pPlayer);
+        else
+            return m_uint32Values[index];
+    }
+    else
+    {
+        // send in current format (float as float, uint32 as uint32)
+        return m_uint32Values[index];
+    }
 }
 
 void Unit::SendMovementHover()
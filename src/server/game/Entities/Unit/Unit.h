@@ -2317,6 +2317,8 @@ class Unit : public WorldObject
         explicit Unit (bool isWorldObject);
 
         void _BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, Player* target) const override;
+        uint32 _GetValuesUpdateField(uint16 index, Player* target) const;
+        static bool IsTargetDependentValuesUpdateField(uint16 index);
 
         UnitAI* i_AI, *i_disabledAI;
 
@@ -137,6 +137,7 @@ bool GameEventMgr::StartEvent(uint16 event_id, bool overwrite)
             if (data.end <= data.start)
                 data.end = data.start + data.length;
         }
+        ScheduleEventCheck(event_id, time(NULL));
         return false;
     }
     else
@@ -154,6 +155,8 @@ bool GameEventMgr::StartEvent(uint16 event_id, bool overwrite)
         bool conditions_met = CheckOneGameEventConditions(event_id);
         // save to db
         SaveWorldEventStateToDB(event_id);
+        ScheduleEventCheck(event_id, time(NULL));
+        ScheduleDependentEventChecks(event_id, time(NULL));
         // force game event update to set the update timer if conditions were met from a command
         // this update is needed to possibly start events dependent on the started one
         // or to scedule another update where the next event will be started
@@ -203,7 +206,28 @@ void GameEventMgr::StopEvent(uint16 event_id, bool overwrite)
 
             CharacterDatabase.CommitTransaction(trans);
         }
+
+        ScheduleDependentEventChecks(event_id, time(NULL));
     }
+
+    ScheduleEventCheck(event_id, time(NULL));
+}
+
+void GameEventMgr::ScheduleEventCheck(uint16 event_id, time_t checkTime)
+{
+    if (event_id >= _eventCheckTimes.size())
+        return;
+
+    _eventCheckTimes[event_id] = checkTime;
+    _eventCheckQueue.insert(EventCheckQueue::value_type(checkTime, event_id));
+}
+
+// inactive world events start when their prerequisites are done, so they have to be checked when one changes
+void GameEventMgr::ScheduleDependentEventChecks(uint16 event_id, time_t checkTime)
+{
+    for (uint16 itr = 1; itr < mGameEvent.size(); ++itr)
+        if (mGameEvent[itr].state == GAMEEVENT_WORLD_INACTIVE && mGameEvent[itr].prerequisite_events.count(event_id))
+            ScheduleEventCheck(itr, checkTime);
 }
 
 void GameEventMgr::LoadFromDB()
@@ -1005,12 +1029,19 @@ void GameEventMgr::Initialize()
         mGameEventPoolIds.resize(maxEventId * 2 - 1);
         mGameEventNPCFlags.resize(maxEventId);
         mGameEventModelEquip.resize(maxEventId);
+        _eventCheckTimes.resize(maxEventId, time_t(0));
     }
 }
 
 uint32 GameEventMgr::StartSystem()                           // return the next event delay in ms
 {
     m_ActiveEvents.clear();
+
+    // the first update checks every event
+    _eventCheckQueue.clear();
+    for (uint16 itr = 1; itr < mGameEvent.size(); ++itr)
+        ScheduleEventCheck(itr, time_t(0));
+
     uint32 delay = Update();
     isSystemInit = true;
     return delay;
@@ -1045,10 +1076,23 @@ uint32 GameEventMgr::Update()                               // return the next e
 {
     time_t currenttime = time(NULL);
     uint32 nextEventDelay = max_ge_check_delay;             // 1 day
-    uint32 calcDelay;
+
+    // only the events whose check time has come
+    std::set<uint16> due;
+    while (!_eventCheckQueue.empty() && _eventCheckQueue.begin()->first <= currenttime)
+    {
+        EventCheckQueue::iterator next = _eventCheckQueue.begin();
+        if (_eventCheckTimes[next->second] == next->first)
+            due.insert(next->second);
+        _eventCheckQueue.erase(next);
+    }
+
     std::set<uint16> activate, deactivate;
-    for (uint16 itr = 1; itr < mGameEvent.size(); ++itr)
+    for (std::set<uint16>::const_iterator dueItr = due.begin(); dueItr != due.end(); ++dueItr)
     {
+        uint16 itr = *dueItr;
+        GameEventState oldState = mGameEvent[itr].state;
+
         // must do the activating first, and after that the deactivating
         // so first queue it
         //sLog->outErrorDb("Checking event %u", itr);
@@ -1065,7 +1109,9 @@ uint32 GameEventMgr::Update()                               // return the next e
                 // queue for deactivation
                 if (IsActiveEvent(itr))
                     deactivate.insert(itr);
-                // go to next event, this no longer needs an event update timer
+                // events waiting for this one can start now
+                ScheduleDependentEventChecks(itr, currenttime);
+                ScheduleEventCheck(itr, currenttime + NextCheck(itr));
                 continue;
             }
             else if (mGameEvent[itr].state == GAMEEVENT_WORLD_CONDITIONS && CheckOneGameEventConditions(itr))
@@ -1092,9 +1138,11 @@ uint32 GameEventMgr::Update()                               // return the next e
                 }
             }
         }
-        calcDelay = NextCheck(itr);
-        if (calcDelay < nextEventDelay)
-            nextEventDelay = calcDelay;
+
+        if (mGameEvent[itr].state != oldState)
+            ScheduleDependentEventChecks(itr, currenttime);
+
+        ScheduleEventCheck(itr, currenttime + NextCheck(itr));
     }
     // now activate the queue
     // a now activated event can contain a spawn of a to-be-deactivated one
@@ -1107,6 +1155,16 @@ uint32 GameEventMgr::Update()                               // return the next e
             nextEventDelay = 0;
     for (std::set<uint16>::iterator itr = deactivate.begin(); itr != deactivate.end(); ++itr)
         StopEvent(*itr);
+
+    if (!_eventCheckQueue.empty())
+    {
+        time_t nextCheck = _eventCheckQueue.begin()->first;
+        if (nextCheck <= currenttime)
+            nextEventDelay = 0;
+        else if (uint32(nextCheck - currenttime) < nextEventDelay)
+            nextEventDelay = uint32(nextCheck - currenttime);
+    }
+
     sLog->outDetail("Next game event check in %u seconds.", nextEventDelay + 1);
     return (nextEventDelay + 1) * IN_MILLISECONDS;           // Add 1 second to be sure event has started/stopped at next call
 }
@@ -1231,16 +1289,10 @@ void GameEventMgr::GameEventSpawn(int16 event_id)
         {
             sObjectMgr->AddCreatureToGrid(*itr, data);
 
-            // Spawn if necessary (loaded grids only)
+            // Spawn if necessary (loaded grids only), done by the map in its own update
             Map* map = sMapMgr->CreateBaseMap(data->mapid);
-            // We use spawn coords to spawn
-            if (!map->Instanceable() && map->IsGridLoaded(data->posX, data->posY))
-            {
-                Creature* creature = new Creature;
-                //sLog->outDebug("Spawning creature %u", *itr);
-                if (!creature->LoadCreatureFromDB(*itr, map))
-                    delete creature;
-            }
+            if (!map->Instanceable())
+                map->QueueSpawnUpdate(TYPEID_UNIT, *itr);
         }
     }
 
@@ -1257,23 +1309,11 @@ void GameEventMgr::GameEventSpawn(int16 event_id)
         if (GameObjectData const* data = sObjectMgr->GetGOData(*itr))
         {
             sObjectMgr->AddGameobjectToGrid(*itr, data);
-            // Spawn if necessary (loaded grids only)
+            // Spawn if necessary (loaded grids only), done by the map in its own update
             // this base map checked as non-instanced and then only existed
             Map* map = sMapMgr->CreateBaseMap(data->mapid);
-            // We use current coords to unspawn, not spawn coords since creature can have changed grid
-            if (!map->Instanceable() && map->IsGridLoaded(data->posX, data->posY))
-            {
-                GameObject* pGameobject = new GameObject;
-                //sLog->outDebug("Spawning gameobject %u", *itr);
-                //TODO: find out when it is add to map
-                if (!pGameobject->LoadGameObjectFromDB(*itr, map, false))
-                    delete pGameobject;
-                else
-                {
-                    if (pGameobject->isSpawnedByDefault())
-                        map->AddToMap(pGameobject);
-                }
-            }
+            if (!map->Instanceable())
+                map->QueueSpawnUpdate(TYPEID_GAMEOBJECT, *itr);
         }
     }
 
@@ -1309,7 +1349,10 @@ void GameEventMgr::GameEventUnspawn(int16 event_id)
         {
             sObjectMgr->RemoveCreatureFromGrid(*itr, data);
 
-            if (Creature* creature = ObjectAccessor::GetObjectInWorld(MAKE_NEW_GUID(*itr, data->id, HIGHGUID_UNIT), (Creature*)NULL))
+            Map* map = sMapMgr->CreateBaseMap(data->mapid);
+            if (!map->Instanceable())
+                map->QueueSpawnUpdate(TYPEID_UNIT, *itr);
+            else if (Creature* creature = ObjectAccessor::GetObjectInWorld(MAKE_NEW_GUID(*itr, data->id, HIGHGUID_UNIT), (Creature*)NULL))
                 creature->AddObjectToRemoveList();
         }
     }
@@ -1331,7 +1374,10 @@ void GameEventMgr::GameEventUnspawn(int16 event_id)
         {
             sObjectMgr->RemoveGameobjectFromGrid(*itr, data);
 
-            if (GameObject* pGameobject = ObjectAccessor::GetObjectInWorld(MAKE_NEW_GUID(*itr, data->id, HIGHGUID_GAMEOBJECT), (GameObject*)NULL))
+            Map* map = sMapMgr->CreateBaseMap(data->mapid);
+            if (!map->Instanceable())
+                map->QueueSpawnUpdate(TYPEID_GAMEOBJECT, *itr);
+            else if (GameObject* pGameobject = ObjectAccessor::GetObjectInWorld(MAKE_NEW_GUID(*itr, data->id, HIGHGUID_GAMEOBJECT), (GameObject*)NULL))
                 pGameobject->AddObjectToRemoveList();
         }
     }
@@ -1640,6 +1686,8 @@ void GameEventMgr::HandleQuestComplete(uint32 quest_id)
                 {
                     // changed, save to DB the gameevent state
                     SaveWorldEventStateToDB(event_id);
+                    // the event only moves on to its next phase when the check queue gets to it
+                    ScheduleEventCheck(event_id, time(NULL));
                     // force update events to set timer
                     sWorld->ForceGameEventUpdate();
                 }
@@ -148,6 +148,8 @@ class GameEventMgr
         bool hasCreatureActiveEventExcept(uint32 creature_guid, uint16 event_id);
         bool hasGameObjectActiveEventExcept(uint32 go_guid, uint16 event_id);
         void sendEventMessage(uint16 event_id, bool start);
+        void ScheduleEventCheck(uint16 event_id, time_t checkTime);
+        void ScheduleDependentEventChecks(uint16 event_id, time_t checkTime);
 
         typedef std::list<uint32> GuidList;
         typedef std::list<uint32> IdList;
@@ -181,6 +183,11 @@ class GameEventMgr
         std::unordered_map<uint32, uint16> _questToEventLinks;
         bool isSystemInit;
 
+        // events ordered by the time they have to be checked again, Update only looks at the due ones
+        typedef std::multimap<time_t, uint16 /*gameevent id*/> EventCheckQueue;
+        EventCheckQueue _eventCheckQueue;
+        std::vector<time_t> _eventCheckTimes;               // entries with another time are outdated
+
     public:
 
         GameEventGuidMap  mGameEventCreatureGuids;
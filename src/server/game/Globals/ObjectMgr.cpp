@@ -5282,6 +5282,8 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
         } while (items->NextRow());
     }
 
+    // all changes go out as one transaction instead of a round trip per mail
+    SQLTransaction trans = CharacterDatabase.BeginTransaction();
     uint32 deletedCount = 0;
     uint32 returnedCount = 0;
     do
@@ -5319,13 +5321,9 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
             // if it is mail from non-player, or if it's already return mail, it shouldn't be returned, but deleted
             if (m->messageType != MAIL_NORMAL || (m->checked & (MAIL_CHECK_MASK_COD_PAYMENT | MAIL_CHECK_MASK_RETURNED)))
             {
-                SQLTransaction trans = CharacterDatabase.BeginTransaction();
-
                 // mail open and then not returned
                 for (MailItemInfoVec::iterator itr2 = m->items.begin(); itr2 != m->items.end(); ++itr2)
                     Item::DeleteFromDB(trans, itr2->item_guid);
-
-                CharacterDatabase.CommitTransaction(trans);
             }
             else
             {
@@ -5337,19 +5335,19 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
                 stmt->setUInt32(3, basetime);
                 stmt->setUInt8 (4, uint8(MAIL_CHECK_MASK_RETURNED));
                 stmt->setUInt32(5, m->messageID);
-                CharacterDatabase.Execute(stmt);
+                trans->Append(stmt);
                 for (MailItemInfoVec::iterator itr2 = m->items.begin(); itr2 != m->items.end(); ++itr2)
                 {
                     // Update receiver in mail items for its proper delivery, and in instance_item for avoid lost item at sender delete
                     stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_ITEM_RECEIVER);
                     stmt->setUInt32(0, m->sender);
                     stmt->setUInt32(1, itr2->item_guid);
-                    CharacterDatabase.Execute(stmt);
+                    trans->Append(stmt);
 
                     stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_ITEM_OWNER);
                     stmt->setUInt32(0, m->sender);
                     stmt->setUInt32(1, itr2->item_guid);
-                    CharacterDatabase.Execute(stmt);
+                    trans->Append(stmt);
                 }
                 delete m;
                 ++returnedCount;
@@ -5359,12 +5357,14 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
 
         stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_BY_ID);
         stmt->setUInt32(0, m->messageID);
-        CharacterDatabase.Execute(stmt);
+        trans->Append(stmt);
         delete m;
         ++deletedCount;
     }
     while (result->NextRow());
 
+    CharacterDatabase.CommitTransaction(trans);
+
     sLog->outString(">> Processed %u expired mails: %u deleted and %u returned in %u ms", deletedCount + returnedCount, deletedCount, returnedCount, GetMSTimeDiffToNow(oldMSTime));
     sLog->outString();
 }
@@ -8928,3 +8928,35 @@ VehicleAccessoryList const* ObjectMgr::GetVehicleAccessoryList(Vehicle* veh) con
         return &itr->second;
     return NULL;
 }
+
+bool ObjectMgr::SendCachedQueryResponse(WorldSession* session, QueryResponseType type, uint32 entry)
+{
+    LocaleConstant locale = session->GetSessionDbLocaleIndex();
+    if (locale >= TOTAL_LOCALES)
+        return false;
+
+    TRINITY_READ_GUARD(ACE_RW_Thread_Mutex, _queryResponseLock);
+    QueryResponseContainer::const_iterator itr = _queryResponseStore[type][locale].find(entry);
+    if (itr == _queryResponseStore[type][locale].end())
+        return false;
+
+    session->SendPacket(&itr->second);
+    return true;
+}
+
+void ObjectMgr::CacheQueryResponse(WorldSession* session, QueryResponseType type, uint32 entry, WorldPacket const& data)
+{
+    LocaleConstant locale = session->GetSessionDbLocaleIndex();
+    if (locale >= TOTAL_LOCALES)
+        return;
+
+    TRINITY_WRITE_GUARD(ACE_RW_Thread_Mutex, _queryResponseLock);
+    _queryResponseStore[type][locale].insert(QueryResponseContainer::value_type(entry, data));
+}
+
+void ObjectMgr::ClearQueryResponses(QueryResponseType type)
+{
+    TRINITY_WRITE_GUARD(ACE_RW_Thread_Mutex, _queryResponseLock);
+    for (uint8 i = 0; i < TOTAL_LOCALES; ++i)
+        _queryResponseStore[type][i].clear();
+}
@@ -585,6 +585,18 @@ struct DungeonEncounter
 typedef std::list<DungeonEncounter const*> DungeonEncounterList;
 typedef std::unordered_map<uint32, DungeonEncounterList> DungeonEncounterContainer;
 
+// Prebuilt SMSG_*_QUERY_RESPONSE packets, kept per locale
+enum QueryResponseType
+{
+    QUERY_RESPONSE_CREATURE,
+    QUERY_RESPONSE_GAMEOBJECT,
+    QUERY_RESPONSE_ITEM,
+    QUERY_RESPONSE_QUEST,
+    MAX_QUERY_RESPONSE_TYPES
+};
+
+typedef std::unordered_map<uint32, WorldPacket> QueryResponseContainer;
+
 class PlayerDumpReader;
 
 class ObjectMgr
@@ -1044,6 +1056,11 @@ class ObjectMgr
             return &itr->second;
         }
 
+        // Query responses are built on first request for each locale and dropped by the matching .reload commands
+        bool SendCachedQueryResponse(WorldSession* session, QueryResponseType type, uint32 entry);
+        void CacheQueryResponse(WorldSession* session, QueryResponseType type, uint32 entry, WorldPacket const& data);
+        void ClearQueryResponses(QueryResponseType type);
+
         GameObjectData const* GetGOData(uint32 guid) const
         {
             GameObjectDataContainer::const_iterator itr = _gameObjectDataStore.find(guid);
@@ -1302,6 +1319,10 @@ class ObjectMgr
         GossipMenuItemsLocaleContainer _gossipMenuItemsLocaleStore;
         PointOfInterestLocaleContainer _pointOfInterestLocaleStore;
 
+        // query opcodes are handled in place, from map threads as well
+        QueryResponseContainer _queryResponseStore[MAX_QUERY_RESPONSE_TYPES][TOTAL_LOCALES];
+        ACE_RW_Thread_Mutex _queryResponseLock;
+
         CacheVendorItemContainer _cacheVendorItemStore;
         CacheTrainerSpellContainer _cacheTrainerSpellStore;
 
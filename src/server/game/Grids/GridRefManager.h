@@ -20,12 +20,56 @@
 #define _GRIDREFMANAGER
 
 #include "RefManager.h"
+#include <vector>
+
+class Player;
 
 template<class OBJECT>
 class GridReference;
 
+// Nothing besides the linked list is kept for most object types
+template<class OBJECT>
+class GridObjectEntries
+{
+    public:
+        void AddEntry(OBJECT* /*obj*/) { }
+        void RemoveEntry(OBJECT* /*obj*/) { }
+};
+
+struct PlayerGridEntry
+{
+    float X;
+    float Y;
+    float Z;
+    uint32 PhaseMask;
+    Player* Target;
+};
+
+/*
+ * The players of a cell are also kept in an array of their position and phase mask, so range checks
+ * of packet broadcasts run over contiguous memory and only touch the players that are in range.
+ * Entries are added and removed together with the grid reference and refreshed by
+ * Player::UpdateGridEntry whenever the player moves inside the cell or changes phase.
+ */
+template<>
+class GridObjectEntries<Player>
+{
+    public:
+        typedef std::vector<PlayerGridEntry> EntryList;
+
+        void AddEntry(Player* player);
+        void RemoveEntry(Player* player);
+        void UpdateEntry(Player* player);
+
+        EntryList const& GetEntries() const { return _entries; }
+
+    private:
+        EntryList _entries;
+};
+
+// GridObjectEntries comes first so its entries outlive the clearReferences() call of ~RefManager
 template<class OBJECT>
-class GridRefManager : public RefManager<GridRefManager<OBJECT>, OBJECT>
+class GridRefManager : public GridObjectEntries<OBJECT>, public RefManager<GridRefManager<OBJECT>, OBJECT>
 {
     public:
         typedef LinkedListHead::Iterator< GridReference<OBJECT> > iterator;
@@ -33,15 +33,21 @@ class GridReference : public Reference<GridRefManager<OBJECT>, OBJECT>
             // called from link()
             this->getTarget()->insertFirst(this);
             this->getTarget()->incSize();
+            this->getTarget()->AddEntry(this->getSource());
         }
         void targetObjectDestroyLink()
         {
             // called from unlink()
-            if (this->isValid()) this->getTarget()->decSize();
+            if (this->isValid())
+            {
+                this->getTarget()->RemoveEntry(this->getSource());
+                this->getTarget()->decSize();
+            }
         }
         void sourceObjectDestroyLink()
         {
             // called from invalidate()
+            this->getTarget()->RemoveEntry(this->getSource());
             this->getTarget()->decSize();
         }
     public:
@@ -31,6 +31,7 @@ void ActiveState::Update(Map &m, NGridType &grid, GridInfo & info, const uint32
     info.UpdateTimeTracker(t_diff);
     if (info.getTimeTracker().Passed())
     {
+        info.setLastActiveTime(time(NULL));
         if (!grid.GetWorldObjectCountInNGrid<Player>() && !m.ActiveObjectsNearGrid(grid))
         {
             ObjectGridStoper worker;
@@ -34,10 +34,10 @@ class GridInfo
 public:
     GridInfo()
         : i_timer(0), vis_Update(0, irand(0, DEFAULT_VISIBILITY_NOTIFY_PERIOD)),
-          i_unloadActiveLockCount(0), i_unloadExplicitLock(false), i_unloadReferenceLock(false) {}
+          i_lastActiveTime(time(NULL)), i_unloadActiveLockCount(0), i_unloadExplicitLock(false), i_unloadReferenceLock(false) {}
     GridInfo(time_t expiry, bool unload = true )
         : i_timer(expiry), vis_Update(0, irand(0, DEFAULT_VISIBILITY_NOTIFY_PERIOD)),
-          i_unloadActiveLockCount(0), i_unloadExplicitLock(!unload), i_unloadReferenceLock(false) {}
+          i_lastActiveTime(time(NULL)), i_unloadActiveLockCount(0), i_unloadExplicitLock(!unload), i_unloadReferenceLock(false) {}
     const TimeTracker& getTimeTracker() const { return i_timer; }
     bool getUnloadLock() const { return i_unloadActiveLockCount || i_unloadExplicitLock || i_unloadReferenceLock; }
     void setUnloadExplicitLock(bool on) { i_unloadExplicitLock = on; }
@@ -49,9 +49,12 @@ public:
     void ResetTimeTracker(time_t interval) { i_timer.Reset(interval); }
     void UpdateTimeTracker(time_t diff) { i_timer.Update(diff); }
     PeriodicTimer& getRelocationTimer() { return vis_Update; }
+    time_t getLastActiveTime() const { return i_lastActiveTime; }
+    void setLastActiveTime(time_t t) { i_lastActiveTime = t; }
 private:
     TimeTracker i_timer;
     PeriodicTimer vis_Update;
+    time_t i_lastActiveTime;                                // last time players or active objects kept the grid active
 
     uint16 i_unloadActiveLockCount : 16;                    // lock from active object spawn points (prevent clone loading)
     bool   i_unloadExplicitLock    : 1;                     // explicit manual lock or config setting
@@ -119,6 +122,7 @@ class NGrid
         void decUnloadActiveLock() { i_GridInfo.decUnloadActiveLock(); }
         void ResetTimeTracker(time_t interval) { i_GridInfo.ResetTimeTracker(interval); }
         void UpdateTimeTracker(time_t diff) { i_GridInfo.UpdateTimeTracker(diff); }
+        time_t getLastActiveTime() const { return i_GridInfo.getLastActiveTime(); }
 
         /*
         template<class SPECIFIC_OBJECT> void AddWorldObject(const uint32 x, const uint32 y, SPECIFIC_OBJECT *obj)
@@ -181,6 +185,16 @@ class NGrid
             return count;
         }
 
+        template<class T>
+        uint32 GetGridObjectCountInNGrid() const
+        {
+            uint32 count = 0;
+            for (uint32 x = 0; x < N; ++x)
+                for (uint32 y = 0; y < N; ++y)
+                    count += i_cells[x][y].template GetGridObjectCountInGrid<T>();
+            return count;
+        }
+
     private:
         uint32 i_gridId;
         GridInfo i_GridInfo;
@@ -64,6 +64,9 @@ void VisibleNotifier::SendToSelf()
         }
     }
 
+    if (!vis_guids.empty())
+        sWorld->AddVisibilityDestroys(vis_guids.size());
+
     for (Player::ClientGUIDs::const_iterator it = vis_guids.begin();it != vis_guids.end(); ++it)
     {
         i_player.m_clientGUIDs.erase(*it);
@@ -255,15 +258,23 @@ void AIRelocationNotifier::Visit(CreatureMapType &m)
 
 void MessageDistDeliverer::Visit(PlayerMapType &m)
 {
-    for (PlayerMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+    // range and phase are checked on the entry array of the cell, only players in range are dereferenced
+    PlayerMapType::EntryList const& entries = m.GetEntries();
+    float const x = i_source->GetPositionX();
+    float const y = i_source->GetPositionY();
+    for (size_t i = 0; i < entries.size(); ++i)
     {
-        Player* target = iter->getSource();
-        if (!target->InSamePhase(i_phaseMask))
+        PlayerGridEntry const& entry = entries[i];
+        if (!(entry.PhaseMask & i_phaseMask))
             continue;
 
-        if (target->GetExactDist2dSq(i_source) > i_distSq)
+        float dx = entry.X - x;
+        float dy = entry.Y - y;
+        if (dx * dx + dy * dy > i_distSq)
             continue;
 
+        Player* target = entry.Target;
+
         // Send packet to all who are sharing the player's vision
         if (!target->GetSharedVisionList().empty())
         {
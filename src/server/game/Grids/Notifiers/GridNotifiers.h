@@ -127,10 +127,11 @@ namespace Trinity
         float i_distSq;
         uint32 team;
         Player const* skipped_receiver;
-        MessageDistDeliverer(WorldObject* src, WorldPacket* msg, float dist, bool own_team_only = false, Player const* skipped = NULL)
+        bool queue_movement;
+        MessageDistDeliverer(WorldObject* src, WorldPacket* msg, float dist, bool own_team_only = false, Player const* skipped = NULL, bool queue = false)
             : i_source(src), i_message(msg), i_phaseMask(src->GetPhaseMask()), i_distSq(dist * dist)
             , team((own_team_only && src->GetTypeId() == TYPEID_PLAYER) ? ((Player*)src)->GetTeam() : 0)
-            , skipped_receiver(skipped)
+            , skipped_receiver(skipped), queue_movement(queue)
         {
         }
         void Visit(PlayerMapType &m);
@@ -147,7 +148,9 @@ namespace Trinity
             if (!player->HaveAtClient(i_source))
                 return;
 
-            if (WorldSession* session = player->GetSession())
+            if (queue_movement)
+                player->QueueMovementRelay(i_message);
+            else if (WorldSession* session = player->GetSession())
                 session->SendPacket(i_message);
         }
     };
@@ -155,7 +158,9 @@ namespace Trinity
     struct ObjectUpdater
     {
         uint32 i_timeDiff;
-        explicit ObjectUpdater(const uint32 diff) : i_timeDiff(diff) {}
+        uint32 i_creatureUpdates;
+        uint32 i_skippedCreatureUpdates;
+        explicit ObjectUpdater(const uint32 diff) : i_timeDiff(diff), i_creatureUpdates(0), i_skippedCreatureUpdates(0) {}
         template<class T> void Visit(GridRefManager<T> &m);
         void Visit(PlayerMapType &) {}
         void Visit(CorpseMapType &) {}
@@ -40,8 +40,21 @@ inline void Trinity::VisibleNotifier::Visit(GridRefManager<T> &m)
 inline void Trinity::ObjectUpdater::Visit(CreatureMapType &m)
 {
     for (CreatureMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
-        if (iter->getSource()->IsInWorld())
-            iter->getSource()->Update(i_timeDiff);
+    {
+        Creature* creature = iter->getSource();
+        if (!creature->IsInWorld())
+            continue;
+
+        uint32 diff = i_timeDiff;
+        if (!creature->PrepareUpdate(diff))
+        {
+            ++i_skippedCreatureUpdates;
+            continue;
+        }
+
+        ++i_creatureUpdates;
+        creature->Update(diff);
+    }
 }
 
 // SEARCHERS & LIST SEARCHERS & WORKERS
@@ -87,13 +87,33 @@ void AddObjectHelper(CellCoord &cell, GridRefManager<T> &m, uint32 &count, Map*
     ++count;
 }
 
+template <class T>
+bool IsWaitingForRespawn(uint32 /*guid*/, Map* /*map*/)
+{
+    return false;
+}
+
+// dead creatures are recreated by the map when their respawn time is reached
+template <>
+bool IsWaitingForRespawn<Creature>(uint32 guid, Map* map)
+{
+    if (!map->IsCreatureUnloadedUntilRespawn(guid))
+        return false;
+
+    map->AddCreatureAwaitingRespawn(guid);
+    return true;
+}
+
 template <class T>
 void LoadHelper(CellGuidSet const& guid_set, CellCoord &cell, GridRefManager<T> &m, uint32 &count, Map* map)
 {
     for (CellGuidSet::const_iterator i_guid = guid_set.begin(); i_guid != guid_set.end(); ++i_guid)
     {
-        T* obj = new T;
         uint32 guid = *i_guid;
+        if (IsWaitingForRespawn<T>(guid, map))
+            continue;
+
+        T* obj = new T;
         //sLog->outString("DEBUG: LoadHelper from table: %s for (guid: %u) Loading", table, guid);
         if (!obj->LoadFromDB(guid, map))
         {
@@ -99,6 +99,7 @@ Group* GroupMgr::GetGroupByDbStoreId(uint32 storageId) const
 
 uint32 GroupMgr::GenerateGroupId()
 {
+    TRINITY_GUARD(ACE_Thread_Mutex, GroupStoreLock);
     if (NextGroupId >= 0xFFFFFFFE)
     {
         sLog->outCrash("Group guid overflow!! Can't continue, shutting down server. ");
@@ -109,6 +110,7 @@ uint32 GroupMgr::GenerateGroupId()
 
 Group* GroupMgr::GetGroupByGUID(uint32 groupId) const
 {
+    TRINITY_GUARD(ACE_Thread_Mutex, GroupStoreLock);
     GroupContainer::const_iterator itr = GroupStore.find(groupId);
     if (itr != GroupStore.end())
         return itr->second;
@@ -118,11 +120,13 @@ Group* GroupMgr::GetGroupByGUID(uint32 groupId) const
 
 void GroupMgr::AddGroup(Group* group)
 {
+    TRINITY_GUARD(ACE_Thread_Mutex, GroupStoreLock);
     GroupStore[group->GetLowGUID()] = group;
 }
 
 void GroupMgr::RemoveGroup(Group* group)
 {
+    TRINITY_GUARD(ACE_Thread_Mutex, GroupStoreLock);
     GroupStore.erase(group->GetLowGUID());
 }
 
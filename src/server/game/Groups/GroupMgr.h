@@ -52,6 +52,7 @@ protected:
     uint32           NextGroupDbStoreId;
     GroupContainer   GroupStore;
     GroupDbContainer GroupDbStore;
+    mutable ACE_Thread_Mutex GroupStoreLock;                // battleground raid groups are created and disbanded on the map threads
 };
 
 #define sGroupMgr ACE_Singleton<GroupMgr, ACE_Null_Mutex>::instance()
@@ -1110,7 +1110,7 @@ InventoryResult Guild::BankMoveItemData::CanStore(Item* pItem, bool swap)
 
 ///////////////////////////////////////////////////////////////////////////////
 // Guild
-Guild::Guild() : m_id(0), m_leaderGuid(0), m_createdDate(0), m_accountsNumber(0), m_bankMoney(0), m_eventLog(NULL)
+Guild::Guild() : m_id(0), m_leaderGuid(0), m_createdDate(0), m_accountsNumber(0), m_bankMoney(0), m_rosterTime(0), m_eventLog(NULL)
 {
     memset(&m_bankEventLog, 0, (GUILD_BANK_MAX_TABS + 1) * sizeof(LogHolder*));
 }
@@ -1243,23 +1243,33 @@ void Guild::Disband()
 // HANDLE CLIENT COMMANDS
 void Guild::HandleRoster(WorldSession* session /*= NULL*/)
 {
-    // Guess size
-    WorldPacket data(SMSG_GUILD_ROSTER, (4 + m_motd.length() + 1 + m_info.length() + 1 + 4 + _GetRanksSize() * (4 + 4 + GUILD_BANK_MAX_TABS * (4 + 4)) + m_members.size() * 50));
-    data << uint32(m_members.size());
-    data << m_motd;
-    data << m_info;
+    // Broadcast is only requested after the roster changed
+    if (!session)
+        _InvalidateRoster();
 
-    data << uint32(_GetRanksSize());
-    for (Ranks::const_iterator ritr = m_ranks.begin(); ritr != m_ranks.end(); ++ritr)
-        ritr->WritePacket(data);
+    time_t now = ::time(NULL);
+    if (!m_rosterTime || now >= m_rosterTime + GUILD_ROSTER_CACHE_TIME)
+    {
+        // Guess size
+        m_roster.Initialize(SMSG_GUILD_ROSTER, (4 + m_motd.length() + 1 + m_info.length() + 1 + 4 + _GetRanksSize() * (4 + 4 + GUILD_BANK_MAX_TABS * (4 + 4)) + m_members.size() * 50));
+        m_roster << uint32(m_members.size());
+        m_roster << m_motd;
+        m_roster << m_info;
 
-    for (Members::const_iterator itr = m_members.begin(); itr != m_members.end(); ++itr)
-        itr->second->WritePacket(data);
+        m_roster << uint32(_GetRanksSize());
+        for (Ranks::const_iterator ritr = m_ranks.begin(); ritr != m_ranks.end(); ++ritr)
+            ritr->WritePacket(m_roster);
+
+        for (Members::const_iterator itr = m_members.begin(); itr != m_members.end(); ++itr)
+            itr->second->WritePacket(m_roster);
+
+        m_rosterTime = now;
+    }
 
     if (session)
-        session->SendPacket(&data);
+        session->SendPacket(&m_roster);
     else
-        BroadcastPacket(&data);
+        BroadcastPacket(&m_roster);
     sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: Sent (SMSG_GUILD_ROSTER)");
 }
 
@@ -1296,6 +1306,7 @@ void Guild::HandleSetMOTD(WorldSession* session, const std::string& motd)
     else
     {
         m_motd = motd;
+        _InvalidateRoster();
 
         sScriptMgr->OnGuildMOTDChanged(this, motd);
 
@@ -1319,6 +1330,7 @@ void Guild::HandleSetInfo(WorldSession* session, const std::string& info)
     else
     {
         m_info = info;
+        _InvalidateRoster();
 
         sScriptMgr->OnGuildInfoChanged(this, info);
 
@@ -1366,6 +1378,7 @@ void Guild::HandleSetLeader(WorldSession* session, const std::string& name)
         {
             _SetLeaderGUID(pNewLeader);
             pOldLeader->ChangeRank(GR_OFFICER);
+            _InvalidateRoster();
             _BroadcastEvent(GE_LEADER_CHANGED, 0, player->GetName(), name.c_str());
         }
     }
@@ -1395,6 +1408,7 @@ void Guild::HandleSetMemberNote(WorldSession* session, const std::string& name,
             member->SetOfficerNote(note);
         else
             member->SetPublicNote(note);
+        _InvalidateRoster();
         HandleRoster(session);
     }
 }
@@ -1603,6 +1617,7 @@ void Guild::HandleUpdateMemberRank(WorldSession* session, const std::string& nam
         // When promoting player, rank is decreased, when demoting - increased
         uint32 newRankId = member->GetRankId() + (demote ? 1 : -1);
         member->ChangeRank(newRankId);
+        _InvalidateRoster();
         _LogEvent(demote ? GUILD_EVENT_LOG_DEMOTE_PLAYER : GUILD_EVENT_LOG_PROMOTE_PLAYER, player->GetGUIDLow(), GUID_LOPART(member->GetGUID()), newRankId);
         _BroadcastEvent(demote ? GE_DEMOTION : GE_PROMOTION, 0, player->GetName(), name.c_str(), _GetRankName(newRankId).c_str());
     }
@@ -1730,15 +1745,28 @@ bool Guild::HandleMemberWithdrawMoney(WorldSession* session, uint32 amount, bool
     return true;
 }
 
-void Guild::HandleMemberLogout(WorldSession* session)
+void Guild::HandleMemberLogin(WorldSession* session)
 {
     Player* player = session->GetPlayer();
     if (Member* member = GetMember(player->GetGUID()))
+        _SetMemberOnline(member, player);
+
+    SendLoginInfo(session);
+}
+
+void Guild::HandleMemberLogout(WorldSession* session)
+{
+    Player* player = session->GetPlayer();
+    Member* member = GetMember(player->GetGUID());
+    if (member)
     {
         member->SetStats(player);
         member->UpdateLogoutTime();
     }
     _BroadcastEvent(GE_SIGNED_OFF, player->GetGUID(), player->GetName());
+
+    if (member)
+        _SetMemberOffline(member);
 }
 
 void Guild::HandleDisband(WorldSession* session)
@@ -2074,26 +2102,29 @@ void Guild::BroadcastToGuild(WorldSession* session, bool officerOnly, const std:
     {
         WorldPacket data;
         ChatHandler::FillMessageData(&data, session, officerOnly ? CHAT_MSG_OFFICER : CHAT_MSG_GUILD, language, NULL, 0, msg.c_str(), NULL);
-        for (Members::const_iterator itr = m_members.begin(); itr != m_members.end(); ++itr)
-            if (Player* player = itr->second->FindPlayer())
-                if (player->GetSession() && _HasRankRight(player, officerOnly ? GR_RIGHT_OFFCHATLISTEN : GR_RIGHT_GCHATLISTEN) &&
-                    !player->GetSocial()->HasIgnore(session->GetPlayer()->GetGUIDLow()))
-                    player->GetSession()->SendPacket(&data);
+
+        uint32 listenRanks = _GetRanksWithRight(officerOnly ? GR_RIGHT_OFFCHATLISTEN : GR_RIGHT_GCHATLISTEN);
+        uint32 senderLowGuid = session->GetPlayer()->GetGUIDLow();
+        for (OnlineMembers::const_iterator itr = m_onlineMembers.begin(); itr != m_onlineMembers.end(); ++itr)
+            if (listenRanks & (1 << (*itr)->GetRankId()))
+                if (Player* player = (*itr)->FindPlayer())
+                    if (player->GetSession() && !player->GetSocial()->HasIgnore(senderLowGuid))
+                        player->GetSession()->SendPacket(&data);
     }
 }
 
 void Guild::BroadcastPacketToRank(WorldPacket* packet, uint8 rankId) const
 {
-    for (Members::const_iterator itr = m_members.begin(); itr != m_members.end(); ++itr)
-        if (itr->second->IsRank(rankId))
-            if (Player* player = itr->second->FindPlayer())
+    for (OnlineMembers::const_iterator itr = m_onlineMembers.begin(); itr != m_onlineMembers.end(); ++itr)
+        if ((*itr)->IsRank(rankId))
+            if (Player* player = (*itr)->FindPlayer())
                 player->GetSession()->SendPacket(packet);
 }
 
 void Guild::BroadcastPacket(WorldPacket* packet) const
 {
-    for (Members::const_iterator itr = m_members.begin(); itr != m_members.end(); ++itr)
-        if (Player* player = itr->second->FindPlayer())
+    for (OnlineMembers::const_iterator itr = m_onlineMembers.begin(); itr != m_onlineMembers.end(); ++itr)
+        if (Player* player = (*itr)->FindPlayer())
             player->GetSession()->SendPacket(packet);
 }
 
@@ -2181,6 +2212,9 @@ bool Guild::AddMember(uint64 guid, uint8 rankId)
         }
     }
     m_members[lowguid] = member;
+    if (player)
+        _SetMemberOnline(member, player);
+    _InvalidateRoster();
 
     SQLTransaction trans(NULL);
     member->SaveToDB(trans);
@@ -2223,6 +2257,8 @@ bool Guild::AddMember(Player *player, uint8 rankId)
     Member* member = new Member(m_id, guid, rankId);
     member->SetStats(player);
     m_members[lowguid] = member;
+    _SetMemberOnline(member, player);
+    _InvalidateRoster();
 
     SQLTransaction trans(NULL);
     member->SaveToDB(trans);
@@ -2280,8 +2316,12 @@ void Guild::DeleteMember(uint64 guid, bool isDisbanding, bool isKicked)
     sScriptMgr->OnGuildRemoveMember(this, player, isDisbanding, isKicked);
 
     if (Member* member = GetMember(guid))
+    {
+        _SetMemberOffline(member);
         delete member;
+    }
     m_members.erase(lowguid);
+    _InvalidateRoster();
 
     // If player not online data in data field will be loaded from guild tabs no need to update it !!
     if (player)
@@ -2301,6 +2341,7 @@ bool Guild::ChangeMemberRank(uint64 guid, uint8 newRank)
         if (Member* member = GetMember(guid))
         {
             member->ChangeRank(newRank);
+            _InvalidateRoster();
             return true;
         }
     return false;
@@ -2436,6 +2477,29 @@ void Guild::_UpdateAccountsNumber()
     m_accountsNumber = accountsIdSet.size();
 }
 
+void Guild::_SetMemberOnline(Member* member, Player* player)
+{
+    if (!member->FindPlayer())
+        m_onlineMembers.push_back(member);
+    member->SetPlayer(player);
+    _InvalidateRoster();
+}
+
+void Guild::_SetMemberOffline(Member* member)
+{
+    if (!member->FindPlayer())
+        return;
+
+    member->SetPlayer(NULL);
+    OnlineMembers::iterator itr = std::find(m_onlineMembers.begin(), m_onlineMembers.end(), member);
+    if (itr != m_onlineMembers.end())
+    {
+        *itr = m_onlineMembers.back();
+        m_onlineMembers.pop_back();
+    }
+    _InvalidateRoster();
+}
+
 // Detects if player is the guild master.
 // Check both leader guid and player's rank (otherwise multiple feature with
 // multiple guild masters won't work)
@@ -2485,6 +2549,7 @@ void Guild::_SetLeaderGUID(Member* pLeader)
 
     m_leaderGuid = pLeader->GetGUID();
     pLeader->ChangeRank(GR_GUILDMASTER);
+    _InvalidateRoster();
 
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_GUILD_LEADER);
     stmt->setUInt32(0, GUID_LOPART(m_leaderGuid));
@@ -2501,6 +2566,7 @@ void Guild::_SetRankBankMoneyPerDay(uint8 rankId, uint32 moneyPerDay)
                 itr->second->ResetMoneyTime();
 
         rankInfo->SetBankMoneyPerDay(moneyPerDay);
+        _InvalidateRoster();
     }
 }
 
@@ -2516,6 +2582,7 @@ void Guild::_SetRankBankTabRightsAndSlots(uint8 rankId, uint8 tabId, GuildBankRi
                 itr->second->ResetTabTimes();
 
         rankInfo->SetBankTabSlotsAndRights(tabId, rightsAndSlots, saveToDB);
+        _InvalidateRoster();
     }
 }
 
@@ -2533,6 +2600,15 @@ inline uint32 Guild::_GetRankRights(uint8 rankId) const
     return 0;
 }
 
+uint32 Guild::_GetRanksWithRight(uint32 right) const
+{
+    uint32 mask = 0;
+    for (uint8 rankId = 0; rankId < _GetRanksSize(); ++rankId)
+        if ((m_ranks[rankId].GetRights() & right) != GR_RIGHT_EMPTY)
+            mask |= 1 << rankId;
+    return mask;
+}
+
 inline uint32 Guild::_GetRankBankMoneyPerDay(uint8 rankId) const
 {
     if (const RankInfo* rankInfo = GetRankInfo(rankId))
@@ -38,6 +38,7 @@ enum GuildMisc
     GUILD_WITHDRAW_MONEY_UNLIMITED      = 0xFFFFFFFF,
     GUILD_WITHDRAW_SLOT_UNLIMITED       = 0xFFFFFFFF,
     GUILD_EVENT_LOG_GUID_UNDEFINED      = 0xFFFFFFFF,
+    GUILD_ROSTER_CACHE_TIME             = 10,                   // seconds a built SMSG_GUILD_ROSTER is reused
 };
 
 enum GuildDefaultRanks
@@ -257,7 +258,7 @@ private:
         };
 
     public:
-        Member(uint32 guildId, uint64 guid, uint8 rankId) : m_guildId(guildId), m_guid(guid), m_logoutTime(::time(NULL)), m_rankId(rankId) { }
+        Member(uint32 guildId, uint64 guid, uint8 rankId) : m_guildId(guildId), m_guid(guid), m_logoutTime(::time(NULL)), m_rankId(rankId), m_player(NULL) { }
 
         void SetStats(Player* player);
         void SetStats(const std::string& name, uint8 level, uint8 _class, uint32 zoneId, uint32 accountId);
@@ -288,7 +289,9 @@ private:
         void ResetTabTimes();
         void ResetMoneyTime();
 
-        inline Player* FindPlayer() const { return ObjectAccessor::FindPlayer(m_guid); }
+        // Online player is tracked by the guild on login/logout, no ObjectAccessor lookup needed
+        inline Player* FindPlayer() const { return m_player; }
+        inline void SetPlayer(Player* player) { m_player = player; }
 
     private:
         uint32 m_guildId;
@@ -306,6 +309,8 @@ private:
         std::string m_officerNote;
 
         RemainingValue m_bankRemaining[GUILD_BANK_MAX_TABS + 1];
+
+        Player* m_player;
     };
 
     // Base class for event entries
@@ -575,6 +580,7 @@ private:
     };
 
     typedef std::unordered_map<uint32, Member*> Members;
+    typedef std::vector<Member*> OnlineMembers;
     typedef std::vector<RankInfo> Ranks;
     typedef std::vector<BankTab*> BankTabs;
 
@@ -615,6 +621,7 @@ public:
     void HandleRemoveLowestRank(WorldSession* session);
     void HandleMemberDepositMoney(WorldSession* session, uint32 amount);
     bool HandleMemberWithdrawMoney(WorldSession* session, uint32 amount, bool repair = false);
+    void HandleMemberLogin(WorldSession* session);
     void HandleMemberLogout(WorldSession* session);
     void HandleDisband(WorldSession* session);
 
@@ -651,8 +658,8 @@ public:
     template<class Do>
     void BroadcastWorker(Do& _do, Player* except = NULL)
     {
-        for (Members::iterator itr = m_members.begin(); itr != m_members.end(); ++itr)
-            if (Player* player = itr->second->FindPlayer())
+        for (OnlineMembers::iterator itr = m_onlineMembers.begin(); itr != m_onlineMembers.end(); ++itr)
+            if (Player* player = (*itr)->FindPlayer())
                 if (player != except)
                     _do(player);
     }
@@ -685,8 +692,12 @@ protected:
 
     Ranks m_ranks;
     Members m_members;
+    OnlineMembers m_onlineMembers;                      // Members currently logged in, broadcasts only visit these
     BankTabs m_bankTabs;
 
+    WorldPacket m_roster;                               // Cached SMSG_GUILD_ROSTER, rebuilt when invalidated or expired
+    time_t m_rosterTime;                                // 0 = invalid
+
     // These are actually ordered lists. The first element is the oldest entry.
     LogHolder* m_eventLog;
     LogHolder* m_bankEventLog[GUILD_BANK_MAX_TABS + 1];
@@ -738,6 +749,12 @@ private:
     void _CreateRank(const std::string& name, uint32 rights);
     // Update account number when member added/removed from guild
     void _UpdateAccountsNumber();
+    // Online members index, maintained on login/logout and membership changes
+    void _SetMemberOnline(Member* member, Player* player);
+    void _SetMemberOffline(Member* member);
+    inline void _InvalidateRoster() { m_rosterTime = 0; }
+    // Bitmask of rank ids having given right
+    uint32 _GetRanksWithRight(uint32 right) const;
     bool _IsLeader(Player* player) const;
     void _DeleteBankItems(SQLTransaction& trans, bool removeItemsFromDB = false);
     bool _ModifyBankMoney(SQLTransaction& trans, uint64 amount, bool add);
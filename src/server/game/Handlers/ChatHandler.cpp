@@ -256,6 +256,9 @@ void WorldSession::HandleMessagechatOpcode(WorldPacket & recv_data)
                 return;
             }
 
+            if (!sender->CanSendLocalChat())
+                return;
+
             if (type == CHAT_MSG_SAY)
                 sender->Say(msg, lang);
             else if (type == CHAT_MSG_EMOTE)
@@ -515,6 +518,9 @@ void WorldSession::HandleTextEmoteOpcode(WorldPacket & recv_data)
     if (!em)
         return;
 
+    if (!GetPlayer()->CanSendLocalChat())
+        return;
+
     uint32 emote_anim = em->textid;
 
     switch (emote_anim)
@@ -287,6 +287,9 @@ void WorldSession::HandleItemQuerySingleOpcode(WorldPacket & recv_data)
 
     sLog->outDetail("STORAGE: Item Query = %u", item);
 
+    if (sObjectMgr->SendCachedQueryResponse(this, QUERY_RESPONSE_ITEM, item))
+        return;
+
     ItemTemplate const* pProto = sObjectMgr->GetItemTemplate(item);
     if (pProto)
     {
@@ -427,6 +430,7 @@ void WorldSession::HandleItemQuerySingleOpcode(WorldPacket & recv_data)
         data << pProto->Duration;                           // added in 2.4.2.8209, duration (seconds)
         data << pProto->ItemLimitCategory;                  // WotLK, ItemLimitCategory
         data << pProto->HolidayId;                          // Holiday.dbc?
+        sObjectMgr->CacheQueryResponse(this, QUERY_RESPONSE_ITEM, item, data);
         SendPacket(&data);
     }
     else
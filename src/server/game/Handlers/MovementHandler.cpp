@@ -365,7 +365,7 @@ void WorldSession::HandleMovementOpcodes(WorldPacket & recvData)
     movementInfo.time = getMSTime();
     movementInfo.guid = mover->GetGUID();
     WriteMovementInfo(&data, &movementInfo);
-    mover->SendMessageToSet(&data, _player);
+    mover->SendMovementToSet(&data, _player);
 
     mover->m_movementInfo = movementInfo;
 
@@ -33,6 +33,7 @@
 #include "DynamicTree.h"
 #include "Transport.h"
 #include "Vehicle.h"
+#include "PoolMgr.h"
 
 union u_map_magic
 {
@@ -58,6 +59,10 @@ Map::~Map()
 
     UnloadAll();
 
+    // grid unloading saved the respawn times of the remaining objects
+    SaveRespawnTimesToDB();
+    sWorld->ModifyCreaturesAwaitingRespawnCount(-int32(_creaturesAwaitingRespawn.size()));
+
     while (!i_worldObjects.empty())
     {
         WorldObject* obj = *i_worldObjects.begin();
@@ -160,6 +165,7 @@ void Map::LoadMap(int gx, int gy, bool reload)
         sLog->outDebug(LOG_FILTER_MAPS, "Unloading previously loaded map %u before reloading.", GetId());
         sScriptMgr->OnUnloadGridMap(this, GridMaps[gx][gy], gx, gy);
 
+        sWorld->ModifyGridTerrainMemory(-int64(GridMaps[gx][gy]->getMemoryUsage()));
         delete (GridMaps[gx][gy]);
         GridMaps[gx][gy]=NULL;
     }
@@ -177,6 +183,7 @@ void Map::LoadMap(int gx, int gy, bool reload)
         sLog->outError("Error loading map file: \n %s\n", tmp);
     }
     delete [] tmp;
+    sWorld->ModifyGridTerrainMemory(GridMaps[gx][gy]->getMemoryUsage());
 
     sScriptMgr->OnLoadGridMap(this, GridMaps[gx][gy], gx, gy);
 }
@@ -213,6 +220,9 @@ m_activeNonPlayersIter(m_activeNonPlayers.end()), _transportsUpdateIter(_transpo
 i_gridExpiry(expiry), i_scriptLock(false)
 {
     m_parentMap = (_parent ? _parent : this);
+    _respawnSaveTimer = 0;
+    _creatureUpdates = 0;
+    _skippedCreatureUpdates = 0;
     for (unsigned int idx=0; idx < MAX_NUMBER_OF_GRIDS; ++idx)
     {
         for (unsigned int j=0; j < MAX_NUMBER_OF_GRIDS; ++j)
@@ -364,6 +374,7 @@ void Map::EnsureGridCreated_i(const GridCoord &p)
 
         setNGrid(new NGridType(p.x_coord*MAX_NUMBER_OF_GRIDS + p.y_coord, p.x_coord, p.y_coord, i_gridExpiry, sWorld->getBoolConfig(CONFIG_GRID_UNLOAD)),
             p.x_coord, p.y_coord);
+        sWorld->ModifyLoadedGridCount(1);
 
         // build a linkage between this map and NGridType
         buildNGridLinkage(getNGrid(p.x_coord, p.y_coord));
@@ -600,6 +611,12 @@ void Map::Update(const uint32 t_diff)
             session->Update(t_diff, updater);
         }
     }
+
+    // movement relayed while handling the packets above goes out as one packet per player
+    if (sWorld->getBoolConfig(CONFIG_MOVEMENT_BATCHING))
+        for (MapRefManager::iterator itr = m_mapRefManager.begin(); itr != m_mapRefManager.end(); ++itr)
+            if (Player* player = itr->getSource())
+                player->SendQueuedMovementRelays();
     /// update active cells around players and active objects
     resetMarkedCells();
 
@@ -647,6 +664,10 @@ void Map::Update(const uint32 t_diff)
         VisitNearbyCellsOf(obj, grid_object_update, world_object_update);
     }
 
+    _creatureUpdates = updater.i_creatureUpdates;
+    _skippedCreatureUpdates = updater.i_skippedCreatureUpdates;
+    sWorld->AddCreatureUpdates(_creatureUpdates, _skippedCreatureUpdates);
+
     ///- Process necessary scripts
     if (!m_scriptSchedule.empty())
     {
@@ -658,6 +679,17 @@ void Map::Update(const uint32 t_diff)
     MoveAllCreaturesInMoveList();
     MoveAllGameObjectsInMoveList();
 
+    ProcessCreatureRespawns();
+    ProcessQueuedSpawnUpdates();
+
+    if (_respawnSaveTimer <= t_diff)
+    {
+        SaveRespawnTimesToDB();
+        _respawnSaveTimer = sWorld->getIntConfig(CONFIG_INTERVAL_RESPAWN_SAVE);
+    }
+    else
+        _respawnSaveTimer -= t_diff;
+
     if (!m_mapRefManager.isEmpty() || !m_activeNonPlayers.empty())
         ProcessRelocationNotifies(t_diff);
 
@@ -755,6 +787,8 @@ void Map::ProcessRelocationNotifies(const uint32 diff)
 
 void Map::RemovePlayerFromMap(Player* player, bool remove)
 {
+    // the client drops the objects of this map anyway
+    player->ClearQueuedMovementRelays();
     player->RemoveFromWorld();
     SendRemoveTransports(player);
 
@@ -835,12 +869,13 @@ void Map::RemoveFromMap(Transport* obj, bool remove)
     }
 }
 
-void Map::PlayerRelocation(Player* player, float x, float y, float z, float orientation)
+void Map::PlayerRelocation(Player* player, float x, float y, float z, float orientation, bool updateVisibility)
 {
     ASSERT(player);
 
     Cell old_cell(player->GetPositionX(), player->GetPositionY());
     Cell new_cell(x, y);
+    bool cellChanged = old_cell.DiffGrid(new_cell) || old_cell.DiffCell(new_cell);
 
     //! If hovering, always increase our server-side Z position
     //! Client automatically projects correct position based on Z coord sent in monster move
@@ -852,7 +887,7 @@ void Map::PlayerRelocation(Player* player, float x, float y, float z, float orie
     if (player->IsVehicle())
         player->GetVehicleKit()->RelocatePassengers(x, y, z, orientation);
 
-    if (old_cell.DiffGrid(new_cell) || old_cell.DiffCell(new_cell))
+    if (cellChanged)
     {
         #ifdef TRINITY_DEBUG
             sLog->outDebug(LOG_FILTER_MAPS, "Player %s relocation grid[%u, %u]cell[%u, %u]->grid[%u, %u]cell[%u, %u]", player->GetName(), old_cell.GridX(), old_cell.GridY(), old_cell.CellX(), old_cell.CellY(), new_cell.GridX(), new_cell.GridY(), new_cell.CellX(), new_cell.CellY());
@@ -868,11 +903,14 @@ void Map::PlayerRelocation(Player* player, float x, float y, float z, float orie
 
         AddToGrid(player, new_cell);
     }
+    else
+        player->UpdateGridEntry();
 
-    player->UpdateObjectVisibility(false);
+    if (cellChanged || updateVisibility)
+        player->UpdateObjectVisibility(false);
 }
 
-void Map::CreatureRelocation(Creature* creature, float x, float y, float z, float ang, bool respawnRelocationOnFail)
+void Map::CreatureRelocation(Creature* creature, float x, float y, float z, float ang, bool respawnRelocationOnFail, bool updateVisibility)
 {
     ASSERT(CheckGridIntegrity(creature, false));
 
@@ -902,14 +940,15 @@ void Map::CreatureRelocation(Creature* creature, float x, float y, float z, floa
         creature->Relocate(x, y, z, ang);
         if (creature->IsVehicle())
             creature->GetVehicleKit()->RelocatePassengers(x, y, z, ang);
-        creature->UpdateObjectVisibility(false);
+        if (updateVisibility)
+            creature->UpdateObjectVisibility(false);
         RemoveCreatureFromMoveList(creature);
     }
 
     ASSERT(CheckGridIntegrity(creature, true));
 }
 
-void Map::GameObjectRelocation(GameObject* go, float x, float y, float z, float orientation, bool respawnRelocationOnFail)
+void Map::GameObjectRelocation(GameObject* go, float x, float y, float z, float orientation, bool respawnRelocationOnFail, bool updateVisibility)
 {
     Cell integrity_check(go->GetPositionX(), go->GetPositionY());
     Cell old_cell = go->GetCurrentCell();
@@ -929,7 +968,8 @@ void Map::GameObjectRelocation(GameObject* go, float x, float y, float z, float
     {
         go->Relocate(x, y, z, orientation);
         go->UpdateModelPosition();
-        go->UpdateObjectVisibility(false);
+        if (updateVisibility)
+            go->UpdateObjectVisibility(false);
         RemoveGameObjectFromMoveList(go);
     }
 
@@ -937,7 +977,7 @@ void Map::GameObjectRelocation(GameObject* go, float x, float y, float z, float
     integrity_check = Cell(go->GetPositionX(), go->GetPositionY());
     ASSERT(integrity_check == old_cell);
 }
-void Map::DynamicObjectRelocation(DynamicObject* dynObj, float x, float y, float z, float orientation)
+void Map::DynamicObjectRelocation(DynamicObject* dynObj, float x, float y, float z, float orientation, bool updateVisibility)
 {
     Cell integrity_check(dynObj->GetPositionX(), dynObj->GetPositionY());
     Cell old_cell = dynObj->GetCurrentCell();
@@ -957,7 +997,8 @@ void Map::DynamicObjectRelocation(DynamicObject* dynObj, float x, float y, float
     else
     {
         dynObj->Relocate(x, y, z, orientation);
-        dynObj->UpdateObjectVisibility(false);
+        if (updateVisibility)
+            dynObj->UpdateObjectVisibility(false);
         RemoveDynamicObjectFromMoveList(dynObj);
     }
 
@@ -1444,6 +1485,7 @@ bool Map::UnloadGrid(NGridType& ngrid, bool unloadAll)
 
         delete &ngrid;
         setNGrid(NULL, x, y);
+        sWorld->ModifyLoadedGridCount(-1);
     }
     int gx = (MAX_NUMBER_OF_GRIDS - 1) - x;
     int gy = (MAX_NUMBER_OF_GRIDS - 1) - y;
@@ -1455,6 +1497,7 @@ bool Map::UnloadGrid(NGridType& ngrid, bool unloadAll)
         {
             if (GridMaps[gx][gy])
             {
+                sWorld->ModifyGridTerrainMemory(-int64(GridMaps[gx][gy]->getMemoryUsage()));
                 GridMaps[gx][gy]->unloadData();
                 delete GridMaps[gx][gy];
             }
@@ -1535,6 +1578,7 @@ GridMap::GridMap()
     _liquidEntry = NULL;
     _liquidFlags = NULL;
     _liquidMap  = NULL;
+    _memoryUsage = 0;
 }
 
 GridMap::~GridMap()
@@ -1604,6 +1648,7 @@ void GridMap::unloadData()
     _liquidEntry = NULL;
     _liquidFlags = NULL;
     _liquidMap  = NULL;
+    _memoryUsage = 0;
     _gridGetHeight = &GridMap::getHeightFromFlat;
 }
 
@@ -1619,6 +1664,7 @@ bool GridMap::loadAreaData(FILE* in, uint32 offset, uint32 /*size*/)
     if (!(header.flags & MAP_AREA_NO_AREA))
     {
         _areaMap = new uint16 [16*16];
+        _memoryUsage += sizeof(uint16) * 16*16;
         if (fread(_areaMap, sizeof(uint16), 16*16, in) != 16*16)
             return false;
     }
@@ -1640,6 +1686,7 @@ bool GridMap::loadHeihgtData(FILE* in, uint32 offset, uint32 /*size*/)
         {
             m_uint16_V9 = new uint16 [129*129];
             m_uint16_V8 = new uint16 [128*128];
+            _memoryUsage += sizeof(uint16) * (129*129 + 128*128);
             if (fread(m_uint16_V9, sizeof(uint16), 129*129, in) != 129*129 ||
                 fread(m_uint16_V8, sizeof(uint16), 128*128, in) != 128*128)
                 return false;
@@ -1650,6 +1697,7 @@ bool GridMap::loadHeihgtData(FILE* in, uint32 offset, uint32 /*size*/)
         {
             m_uint8_V9 = new uint8 [129*129];
             m_uint8_V8 = new uint8 [128*128];
+            _memoryUsage += sizeof(uint8) * (129*129 + 128*128);
             if (fread(m_uint8_V9, sizeof(uint8), 129*129, in) != 129*129 ||
                 fread(m_uint8_V8, sizeof(uint8), 128*128, in) != 128*128)
                 return false;
@@ -1660,6 +1708,7 @@ bool GridMap::loadHeihgtData(FILE* in, uint32 offset, uint32 /*size*/)
         {
             m_V9 = new float [129*129];
             m_V8 = new float [128*128];
+            _memoryUsage += sizeof(float) * (129*129 + 128*128);
             if (fread(m_V9, sizeof(float), 129*129, in) != 129*129 ||
                 fread(m_V8, sizeof(float), 128*128, in) != 128*128)
                 return false;
@@ -1693,12 +1742,14 @@ bool GridMap::loadLiquidData(FILE* in, uint32 offset, uint32 /*size*/)
             return false;
 
         _liquidFlags = new uint8[16*16];
+        _memoryUsage += (sizeof(uint16) + sizeof(uint8)) * 16*16;
         if (fread(_liquidFlags, sizeof(uint8), 16*16, in) != 16*16)
             return false;
     }
     if (!(header.flags & MAP_LIQUID_NO_HEIGHT))
     {
         _liquidMap = new float[_liquidWidth*_liquidHeight];
+        _memoryUsage += sizeof(float) * _liquidWidth*_liquidHeight;
         if (fread(_liquidMap, sizeof(float), _liquidWidth*_liquidHeight, in) != _liquidWidth*_liquidHeight)
             return false;
     }
@@ -2450,7 +2501,7 @@ void Map::UpdateObjectVisibility(WorldObject* obj, Cell cell, CellCoord cellpair
     cell.SetNoCreate();
     Trinity::VisibleChangesNotifier notifier(*obj);
     TypeContainerVisitor<Trinity::VisibleChangesNotifier, WorldTypeMapContainer > player_notifier(notifier);
-    cell.Visit(cellpair, player_notifier, *this, *obj, obj->GetVisibilityRange());
+    cell.Visit(cellpair, player_notifier, *this, *obj, obj->GetClientVisibilityRange());
 }
 
 void Map::UpdateObjectsVisibilityFor(Player* player, Cell cell, CellCoord cellpair)
@@ -2460,8 +2511,10 @@ void Map::UpdateObjectsVisibilityFor(Player* player, Cell cell, CellCoord cellpa
     cell.SetNoCreate();
     TypeContainerVisitor<Trinity::VisibleNotifier, WorldTypeMapContainer > world_notifier(notifier);
     TypeContainerVisitor<Trinity::VisibleNotifier, GridTypeMapContainer  > grid_notifier(notifier);
-    cell.Visit(cellpair, world_notifier, *this, *player, player->GetSightRange());
-    cell.Visit(cellpair, grid_notifier,  *this, *player, player->GetSightRange());
+    // objects the client has are kept up to the leave margin beyond the sight range, see WorldObject::canSeeOrDetect
+    float radius = player->GetSightRange() + sWorld->getFloatConfig(CONFIG_VISIBILITY_LEAVE_MARGIN);
+    cell.Visit(cellpair, world_notifier, *this, *player, radius);
+    cell.Visit(cellpair, grid_notifier,  *this, *player, radius);
 
     // send data
     notifier.SendToSelf();
@@ -2543,9 +2596,81 @@ void Map::DelayedUpdate(const uint32 t_diff)
             ASSERT(grid->GetGridState() >= 0 && grid->GetGridState() < MAX_GRID_STATE);
             si_GridStates[grid->GetGridState()]->Update(*this, *grid, *info, t_diff);
         }
+
+        if (uint32 memoryLimit = sWorld->getIntConfig(CONFIG_GRID_UNLOAD_MEMORY_LIMIT))
+            if (GetLoadedGridMemoryUsage() > uint64(memoryLimit) * 1024 * 1024)
+                UnloadLeastRecentlyActiveGrid();
+    }
+}
+
+void Map::UnloadLeastRecentlyActiveGrid()
+{
+    NGridType* oldest = NULL;
+    for (GridRefManager<NGridType>::iterator i = GridRefManager<NGridType>::begin(); i != GridRefManager<NGridType>::end(); ++i)
+    {
+        NGridType* grid = i->getSource();
+        if (grid->GetGridState() != GRID_STATE_REMOVAL || grid->getUnloadLock())
+            continue;
+
+        if (!oldest || grid->getLastActiveTime() < oldest->getLastActiveTime())
+            oldest = grid;
+    }
+
+    if (!oldest)
+        return;
+
+    uint32 x = oldest->getX();
+    uint32 y = oldest->getY();
+    if (UnloadGrid(*oldest, false))
+        sLog->outDebug(LOG_FILTER_MAPS, "Grid[%u, %u] for map %u unloaded early because of the grid memory limit", x, y, GetId());
+    else
+        ResetGridExpiry(*oldest);
+}
+
+void Map::GetGridMemoryUsage(std::vector<GridMemoryUsage>& grids)
+{
+    VMAP::IVMapManager* vmgr = VMAP::VMapFactory::createOrGetVMapManager();
+    for (GridRefManager<NGridType>::iterator i = GridRefManager<NGridType>::begin(); i != GridRefManager<NGridType>::end(); ++i)
+    {
+        NGridType const* grid = i->getSource();
+
+        GridMemoryUsage usage;
+        usage.GridX = grid->getX();
+        usage.GridY = grid->getY();
+        usage.State = grid->GetGridState();
+        usage.LastActiveTime = grid->getLastActiveTime();
+        usage.Creatures = grid->GetGridObjectCountInNGrid<Creature>() + grid->GetWorldObjectCountInNGrid<Creature>();
+        usage.GameObjects = grid->GetGridObjectCountInNGrid<GameObject>();
+        usage.Players = grid->GetWorldObjectCountInNGrid<Player>();
+        uint32 dynamicObjects = grid->GetGridObjectCountInNGrid<DynamicObject>() + grid->GetWorldObjectCountInNGrid<DynamicObject>();
+        uint32 corpses = grid->GetGridObjectCountInNGrid<Corpse>() + grid->GetWorldObjectCountInNGrid<Corpse>();
+        usage.OtherObjects = dynamicObjects + corpses;
+        usage.ObjectBytes = sizeof(NGridType) + uint64(usage.Creatures) * sizeof(Creature) + uint64(usage.GameObjects) * sizeof(GameObject) +
+            uint64(usage.Players) * sizeof(Player) + uint64(dynamicObjects) * sizeof(DynamicObject) + uint64(corpses) * sizeof(Corpse);
+
+        if (i_InstanceId == 0)
+        {
+            // x and y are swapped
+            int gx = (MAX_NUMBER_OF_GRIDS - 1) - usage.GridX;
+            int gy = (MAX_NUMBER_OF_GRIDS - 1) - usage.GridY;
+            if (GridMaps[gx][gy])
+                usage.TerrainBytes = GridMaps[gx][gy]->getMemoryUsage();
+            if (vmgr)
+                usage.VMapBytes = vmgr->getTileMemoryUsage(GetId(), gx, gy);
+        }
+
+        grids.push_back(usage);
     }
 }
 
+uint64 Map::GetLoadedGridMemoryUsage()
+{
+    uint64 bytes = sWorld->GetGridTerrainMemory() + uint64(sWorld->GetLoadedGridCount()) * sizeof(NGridType);
+    if (VMAP::IVMapManager* vmgr = VMAP::VMapFactory::createOrGetVMapManager())
+        bytes += vmgr->getLoadedModelMemoryUsage();
+    return bytes;
+}
+
 void Map::AddObjectToRemoveList(WorldObject* obj)
 {
     ASSERT(obj->GetMapId() == GetId() && obj->GetInstanceId() == GetInstanceId());
@@ -3211,6 +3336,18 @@ void BattlegroundMap::RemovePlayerFromMap(Player* player, bool remove)
     Map::RemovePlayerFromMap(player, remove);
 }
 
+void BattlegroundMap::Update(const uint32 diff)
+{
+    Map::Update(diff);
+
+    // the battleground itself is updated here on the map thread, BattlegroundMgr only deletes finished ones
+    if (m_bg)
+    {
+        m_bg->Update(diff);
+        m_bg->FlushWorldStates();
+    }
+}
+
 void BattlegroundMap::SetUnload()
 {
     m_unloadTimer = MIN_UNLOAD_DELAY;
@@ -3270,24 +3407,20 @@ void Map::SaveCreatureRespawnTime(uint32 dbGuid, time_t respawnTime)
     }
 
     _creatureRespawnTimes[dbGuid] = respawnTime;
+    _pendingCreatureRespawnSaves[dbGuid] = respawnTime;
 
-    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_CREATURE_RESPAWN);
-    stmt->setUInt32(0, dbGuid);
-    stmt->setUInt32(1, uint32(respawnTime));
-    stmt->setUInt16(2, GetId());
-    stmt->setUInt32(3, GetInstanceId());
-    CharacterDatabase.Execute(stmt);
+    if (CanUnloadCreatureUntilRespawn(dbGuid))
+        _creatureRespawnQueue.insert(std::make_pair(respawnTime, dbGuid));
 }
 
 void Map::RemoveCreatureRespawnTime(uint32 dbGuid)
 {
     _creatureRespawnTimes.erase(dbGuid);
+    _pendingCreatureRespawnSaves[dbGuid] = time_t(0);
 
-    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CREATURE_RESPAWN);
-    stmt->setUInt32(0, dbGuid);
-    stmt->setUInt16(1, GetId());
-    stmt->setUInt32(2, GetInstanceId());
-    CharacterDatabase.Execute(stmt);
+    // the respawn time was cleared while the creature was not in the grid, bring it back now
+    if (_creaturesAwaitingRespawn.find(dbGuid) != _creaturesAwaitingRespawn.end())
+        _creatureRespawnQueue.insert(std::make_pair(time_t(0), dbGuid));
 }
 
 void Map::SaveGORespawnTime(uint32 dbGuid, time_t respawnTime)
@@ -3300,24 +3433,244 @@ void Map::SaveGORespawnTime(uint32 dbGuid, time_t respawnTime)
     }
 
     _goRespawnTimes[dbGuid] = respawnTime;
-
-    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_GO_RESPAWN);
-    stmt->setUInt32(0, dbGuid);
-    stmt->setUInt32(1, uint32(respawnTime));
-    stmt->setUInt16(2, GetId());
-    stmt->setUInt32(3, GetInstanceId());
-    CharacterDatabase.Execute(stmt);
+    _pendingGORespawnSaves[dbGuid] = respawnTime;
 }
 
 void Map::RemoveGORespawnTime(uint32 dbGuid)
 {
     _goRespawnTimes.erase(dbGuid);
+    _pendingGORespawnSaves[dbGuid] = time_t(0);
+}
 
-    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GO_RESPAWN);
-    stmt->setUInt32(0, dbGuid);
-    stmt->setUInt16(1, GetId());
-    stmt->setUInt32(2, GetInstanceId());
-    CharacterDatabase.Execute(stmt);
+void Map::SaveRespawnTimesToDB()
+{
+    if (_pendingCreatureRespawnSaves.empty() && _pendingGORespawnSaves.empty())
+        return;
+
+    SQLTransaction trans = CharacterDatabase.BeginTransaction();
+    for (std::unordered_map<uint32, time_t>::const_iterator itr = _pendingCreatureRespawnSaves.begin(); itr != _pendingCreatureRespawnSaves.end(); ++itr)
+    {
+        PreparedStatement* stmt;
+        if (itr->second)
+        {
+            stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_CREATURE_RESPAWN);
+            stmt->setUInt32(0, itr->first);
+            stmt->setUInt32(1, uint32(itr->second));
+            stmt->setUInt16(2, GetId());
+            stmt->setUInt32(3, GetInstanceId());
+        }
+        else
+        {
+            stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CREATURE_RESPAWN);
+            stmt->setUInt32(0, itr->first);
+            stmt->setUInt16(1, GetId());
+            stmt->setUInt32(2, GetInstanceId());
+        }
+        trans->Append(stmt);
+    }
+
+    for (std::unordered_map<uint32, time_t>::const_iterator itr = _pendingGORespawnSaves.begin(); itr != _pendingGORespawnSaves.end(); ++itr)
+    {
+        PreparedStatement* stmt;
+        if (itr->second)
+        {
+            stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_GO_RESPAWN);
+            stmt->setUInt32(0, itr->first);
+            stmt->setUInt32(1, uint32(itr->second));
+            stmt->setUInt16(2, GetId());
+            stmt->setUInt32(3, GetInstanceId());
+        }
+        else
+        {
+            stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GO_RESPAWN);
+            stmt->setUInt32(0, itr->first);
+            stmt->setUInt16(1, GetId());
+            stmt->setUInt32(2, GetInstanceId());
+        }
+        trans->Append(stmt);
+    }
+
+    CharacterDatabase.CommitTransaction(trans);
+    sWorld->AddRespawnTimeTransaction(_pendingCreatureRespawnSaves.size() + _pendingGORespawnSaves.size());
+
+    _pendingCreatureRespawnSaves.clear();
+    _pendingGORespawnSaves.clear();
+}
+
+bool Map::CanUnloadCreatureUntilRespawn(uint32 dbGuid) const
+{
+    if (Instanceable() || !sWorld->getBoolConfig(CONFIG_RESPAWN_UNLOAD_DEAD_CREATURES))
+        return false;
+
+    CreatureData const* data = sObjectMgr->GetCreatureData(dbGuid);
+    if (!data || !data->dbData)
+        return false;
+
+    // scripts may delay the respawn through CreatureAI::CanRespawn, which needs the creature
+    CreatureTemplate const* cInfo = sObjectMgr->GetCreatureTemplate(data->id);
+    if (!cInfo || cInfo->ScriptID)
+        return false;
+
+    // pools pick the next spawn when the creature respawns
+    if (sPoolMgr->IsPartOfAPool<Creature>(dbGuid))
+        return false;
+
+    return true;
+}
+
+bool Map::IsCreatureUnloadedUntilRespawn(uint32 dbGuid) const
+{
+    time_t respawnTime = GetCreatureRespawnTime(dbGuid);
+    return respawnTime > time(NULL) && CanUnloadCreatureUntilRespawn(dbGuid);
+}
+
+void Map::AddCreatureAwaitingRespawn(uint32 dbGuid)
+{
+    if (_creaturesAwaitingRespawn.insert(dbGuid).second)
+        sWorld->ModifyCreaturesAwaitingRespawnCount(1);
+}
+
+void Map::RemoveCreatureAwaitingRespawn(uint32 dbGuid)
+{
+    if (_creaturesAwaitingRespawn.erase(dbGuid))
+        sWorld->ModifyCreaturesAwaitingRespawnCount(-1);
+}
+
+void Map::ProcessCreatureRespawns()
+{
+    time_t now = time(NULL);
+    while (!_creatureRespawnQueue.empty() && _creatureRespawnQueue.begin()->first <= now)
+    {
+        time_t respawnTime = _creatureRespawnQueue.begin()->first;
+        uint32 dbGuid = _creatureRespawnQueue.begin()->second;
+        _creatureRespawnQueue.erase(_creatureRespawnQueue.begin());
+
+        // superseded by a later respawn time, or the creature is in the grid and respawns itself
+        if (GetCreatureRespawnTime(dbGuid) != respawnTime || _creaturesAwaitingRespawn.find(dbGuid) == _creaturesAwaitingRespawn.end())
+            continue;
+
+        CreatureData const* data = sObjectMgr->GetCreatureData(dbGuid);
+        if (!data)
+        {
+            RemoveCreatureAwaitingRespawn(dbGuid);
+            continue;
+        }
+
+        // same rules as Creature::Update for dead creatures
+        uint64 dbtableHighGuid = MAKE_NEW_GUID(dbGuid, data->id, HIGHGUID_UNIT);
+        if (time_t linkedRespawnTime = GetLinkedRespawnTime(dbtableHighGuid))
+        {
+            if (sObjectMgr->GetLinkedRespawnGuid(dbtableHighGuid) == dbtableHighGuid)
+                SaveCreatureRespawnTime(dbGuid, now + DAY);
+            else
+                SaveCreatureRespawnTime(dbGuid, (now > linkedRespawnTime ? now : linkedRespawnTime) + urand(5, MINUTE));
+            continue;
+        }
+
+        RemoveCreatureAwaitingRespawn(dbGuid);
+
+        // the grid loader creates it when the grid is loaded again
+        if (!IsGridLoaded(data->posX, data->posY))
+            continue;
+
+        // despawned by a game event meanwhile
+        CellCoord cellCoord = Trinity::ComputeCellCoord(data->posX, data->posY);
+        CellObjectGuids const& cellGuids = sObjectMgr->GetCellObjectGuids(GetId(), GetSpawnMode(), cellCoord.GetId());
+        if (cellGuids.creatures.find(dbGuid) == cellGuids.creatures.end())
+            continue;
+
+        RemoveCreatureRespawnTime(dbGuid);
+
+        Creature* creature = new Creature;
+        if (!creature->LoadCreatureFromDB(dbGuid, this))
+            delete creature;
+        else
+            sWorld->IncreaseQueuedRespawnCount();
+    }
+}
+
+void Map::QueueSpawnUpdate(uint8 typeId, uint32 dbGuid)
+{
+    ACE_GUARD(ACE_Thread_Mutex, guard, _queuedSpawnUpdatesLock);
+    _queuedSpawnUpdates.push_back(std::make_pair(typeId, dbGuid));
+}
+
+void Map::ProcessQueuedSpawnUpdates()
+{
+    std::deque<std::pair<uint8, uint32> > spawnUpdates;
+    {
+        ACE_GUARD(ACE_Thread_Mutex, guard, _queuedSpawnUpdatesLock);
+        if (_queuedSpawnUpdates.empty())
+            return;
+
+        uint32 limit = sWorld->getIntConfig(CONFIG_EVENT_SPAWNS_PER_MAP_UPDATE);
+        if (!limit || _queuedSpawnUpdates.size() <= limit)
+            spawnUpdates.swap(_queuedSpawnUpdates);
+        else
+        {
+            spawnUpdates.assign(_queuedSpawnUpdates.begin(), _queuedSpawnUpdates.begin() + limit);
+            _queuedSpawnUpdates.erase(_queuedSpawnUpdates.begin(), _queuedSpawnUpdates.begin() + limit);
+        }
+    }
+
+    for (std::deque<std::pair<uint8, uint32> >::const_iterator itr = spawnUpdates.begin(); itr != spawnUpdates.end(); ++itr)
+    {
+        uint32 dbGuid = itr->second;
+        if (itr->first == TYPEID_UNIT)
+        {
+            CreatureData const* data = sObjectMgr->GetCreatureData(dbGuid);
+            if (!data)
+                continue;
+
+            CellCoord cellCoord = Trinity::ComputeCellCoord(data->posX, data->posY);
+            CellObjectGuids const& cellGuids = sObjectMgr->GetCellObjectGuids(GetId(), GetSpawnMode(), cellCoord.GetId());
+            bool registered = cellGuids.creatures.find(dbGuid) != cellGuids.creatures.end();
+
+            if (Creature* creature = GetCreature(MAKE_NEW_GUID(dbGuid, data->id, HIGHGUID_UNIT)))
+            {
+                if (!registered)
+                    creature->AddObjectToRemoveList();
+            }
+            else if (registered && IsGridLoaded(data->posX, data->posY))
+            {
+                // creatures unloaded until their respawn are spawned by ProcessCreatureRespawns, like the grid loader does
+                if (IsCreatureUnloadedUntilRespawn(dbGuid))
+                    AddCreatureAwaitingRespawn(dbGuid);
+                else
+                {
+                    Creature* creature = new Creature;
+                    if (!creature->LoadCreatureFromDB(dbGuid, this))
+                        delete creature;
+                }
+            }
+        }
+        else
+        {
+            GameObjectData const* data = sObjectMgr->GetGOData(dbGuid);
+            if (!data)
+                continue;
+
+            CellCoord cellCoord = Trinity::ComputeCellCoord(data->posX, data->posY);
+            CellObjectGuids const& cellGuids = sObjectMgr->GetCellObjectGuids(GetId(), GetSpawnMode(), cellCoord.GetId());
+            bool registered = cellGuids.gameobjects.find(dbGuid) != cellGuids.gameobjects.end();
+
+            if (GameObject* gameobject = GetGameObject(MAKE_NEW_GUID(dbGuid, data->id, HIGHGUID_GAMEOBJECT)))
+            {
+                if (!registered)
+                    gameobject->AddObjectToRemoveList();
+            }
+            else if (registered && IsGridLoaded(data->posX, data->posY))
+            {
+                GameObject* gameobject = new GameObject;
+                if (!gameobject->LoadGameObjectFromDB(dbGuid, this, false))
+                    delete gameobject;
+                else if (gameobject->isSpawnedByDefault())
+                    AddToMap(gameobject);
+                else
+                    delete gameobject;
+            }
+        }
+    }
 }
 
 void Map::LoadRespawnTimes()
@@ -3334,6 +3687,8 @@ void Map::LoadRespawnTimes()
             uint32 respawnTime = fields[1].GetUInt32();
 
             _creatureRespawnTimes[loguid] = time_t(respawnTime);
+            if (CanUnloadCreatureUntilRespawn(loguid))
+                _creatureRespawnQueue.insert(std::make_pair(time_t(respawnTime), loguid));
         } while (result->NextRow());
     }
 
@@ -3357,6 +3712,8 @@ void Map::DeleteRespawnTimes()
 {
     _creatureRespawnTimes.clear();
     _goRespawnTimes.clear();
+    _pendingCreatureRespawnSaves.clear();
+    _pendingGORespawnSaves.clear();
 
     DeleteRespawnTimesInDB(GetId(), GetInstanceId());
 }
@@ -34,8 +34,10 @@
 #include "GameObjectModel.h"
 
 #include <bitset>
+#include <deque>
 #include <list>
 #include <unordered_map>
+#include <unordered_set>
 
 class Unit;
 class WorldPacket;
@@ -188,6 +190,7 @@ class GridMap
     uint8 _liquidWidth;
     uint8 _liquidHeight;
 
+    uint32 _memoryUsage;                                    // bytes of the loaded height, area and liquid data
 
     bool loadAreaData(FILE* in, uint32 offset, uint32 size);
     bool loadHeihgtData(FILE* in, uint32 offset, uint32 size);
@@ -206,6 +209,7 @@ public:
     ~GridMap();
     bool loadData(char* filaname);
     void unloadData();
+    uint32 getMemoryUsage() const { return sizeof(GridMap) + _memoryUsage; }
 
     uint16 getArea(float x, float y) const;
     inline float getHeight(float x, float y) const {return (this->*_gridGetHeight)(x, y);}
@@ -247,6 +251,25 @@ enum LevelRequirementVsMode
 
 typedef std::map<uint32/*leaderDBGUID*/, CreatureGroup*>        CreatureGroupHolderType;
 
+// memory accounting of a loaded grid, object bytes only count the object classes themselves
+struct GridMemoryUsage
+{
+    GridMemoryUsage() : GridX(0), GridY(0), State(GRID_STATE_INVALID), LastActiveTime(0),
+        Creatures(0), GameObjects(0), Players(0), OtherObjects(0), ObjectBytes(0), TerrainBytes(0), VMapBytes(0) { }
+
+    uint32 GridX;
+    uint32 GridY;
+    grid_state_t State;
+    time_t LastActiveTime;
+    uint32 Creatures;
+    uint32 GameObjects;
+    uint32 Players;
+    uint32 OtherObjects;                                    // dynamic objects and corpses
+    uint64 ObjectBytes;                                     // includes the grid and its cells
+    uint64 TerrainBytes;                                    // only for the map owning the terrain, instances share the base map's
+    uint64 VMapBytes;                                       // models shared between tiles are counted for each of them
+};
+
 class Map : public GridRefManager<NGridType>
 {
     friend class MapReference;
@@ -281,10 +304,11 @@ class Map : public GridRefManager<NGridType>
         //function for setting up visibility distance for maps on per-type/per-Id basis
         virtual void InitVisibilityDistance();
 
-        void PlayerRelocation(Player*, float x, float y, float z, float orientation);
-        void CreatureRelocation(Creature* creature, float x, float y, float z, float ang, bool respawnRelocationOnFail = true);
-        void GameObjectRelocation(GameObject* go, float x, float y, float z, float orientation, bool respawnRelocationOnFail = true);
-        void DynamicObjectRelocation(DynamicObject* go, float x, float y, float z, float orientation);
+        // updateVisibility = false skips the visibility notification for moves within the same cell
+        void PlayerRelocation(Player*, float x, float y, float z, float orientation, bool updateVisibility = true);
+        void CreatureRelocation(Creature* creature, float x, float y, float z, float ang, bool respawnRelocationOnFail = true, bool updateVisibility = true);
+        void GameObjectRelocation(GameObject* go, float x, float y, float z, float orientation, bool respawnRelocationOnFail = true, bool updateVisibility = true);
+        void DynamicObjectRelocation(DynamicObject* go, float x, float y, float z, float orientation, bool updateVisibility = true);
 
         template<class T, class CONTAINER> void Visit(const Cell& cell, TypeContainerVisitor<T, CONTAINER> &visitor);
 
@@ -497,9 +521,27 @@ class Map : public GridRefManager<NGridType>
         void RemoveGORespawnTime(uint32 dbGuid);
         void LoadRespawnTimes();
         void DeleteRespawnTimes();
+        void SaveRespawnTimesToDB();
 
         static void DeleteRespawnTimesInDB(uint16 mapId, uint32 instanceId);
 
+        // dead creatures that may be deleted and recreated by the map when their respawn time is reached
+        bool CanUnloadCreatureUntilRespawn(uint32 dbGuid) const;
+        bool IsCreatureUnloadedUntilRespawn(uint32 dbGuid) const;
+        void AddCreatureAwaitingRespawn(uint32 dbGuid);
+        uint32 GetCreaturesAwaitingRespawnCount() const { return uint32(_creaturesAwaitingRespawn.size()); }
+
+        void GetGridMemoryUsage(std::vector<GridMemoryUsage>& grids);
+        // terrain, vmap models and grid containers of all maps, checked against GridUnload.MemoryLimit
+        static uint64 GetLoadedGridMemoryUsage();
+
+        // brings a DB spawn in line with its cell registration (spawned if registered, removed if not) in a later map update
+        void QueueSpawnUpdate(uint8 typeId, uint32 dbGuid);
+
+        // creature updates of the last map update, and how many of them idle creatures skipped
+        uint32 GetCreatureUpdateCount() const { return _creatureUpdates; }
+        uint32 GetSkippedCreatureUpdateCount() const { return _skippedCreatureUpdates; }
+
     private:
         void LoadMapAndVMap(int gx, int gy);
         void LoadVMap(int gx, int gy);
@@ -650,6 +692,29 @@ class Map : public GridRefManager<NGridType>
 
         std::unordered_map<uint32 /*dbGUID*/, time_t> _creatureRespawnTimes;
         std::unordered_map<uint32 /*dbGUID*/, time_t> _goRespawnTimes;
+
+        void ProcessCreatureRespawns();
+        void RemoveCreatureAwaitingRespawn(uint32 dbGuid);
+
+        std::multimap<time_t, uint32 /*dbGUID*/> _creatureRespawnQueue;
+        std::unordered_set<uint32 /*dbGUID*/> _creaturesAwaitingRespawn;
+
+        // respawn times not written to the DB yet, 0 deletes the row
+        std::unordered_map<uint32 /*dbGUID*/, time_t> _pendingCreatureRespawnSaves;
+        std::unordered_map<uint32 /*dbGUID*/, time_t> _pendingGORespawnSaves;
+        uint32 _respawnSaveTimer;
+
+        uint32 _creatureUpdates;
+        uint32 _skippedCreatureUpdates;
+
+        void ProcessQueuedSpawnUpdates();
+
+        // memory pressure unload, idle grids that were active the longest time ago go first
+        void UnloadLeastRecentlyActiveGrid();
+
+        // filled by GameEventMgr, which may run outside this map's thread
+        std::deque<std::pair<uint8 /*TypeID*/, uint32 /*dbGUID*/> > _queuedSpawnUpdates;
+        ACE_Thread_Mutex _queuedSpawnUpdatesLock;
 };
 
 enum InstanceResetMethod
@@ -700,6 +765,7 @@ class BattlegroundMap : public Map
         bool AddPlayerToMap(Player*);
         void RemovePlayerFromMap(Player*, bool);
         bool CanEnter(Player* player);
+        void Update(const uint32);
         void SetUnload();
         //void UnloadAll(bool pForce);
         void RemoveAllPlayers();
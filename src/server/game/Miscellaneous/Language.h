@@ -1036,7 +1036,21 @@ enum TrinityStrings
     LANG_COMMAND_NO_BATTLEGROUND_FOUND  = 5032,
     LANG_COMMAND_NO_ACHIEVEMENT_CRITERIA_FOUND = 5033,
     LANG_COMMAND_NO_OUTDOOR_PVP_FORUND  = 5034,
-    // Room for more Trinity strings      5035-9999
+    LANG_SERVER_LOCAL_CHAT_DROPPED      = 5035,
+    LANG_SERVER_WORLD_STATES_SAVED      = 5036,
+    LANG_SERVER_MOVEMENT_RELAYS         = 5037,
+    LANG_SERVER_DEAD_CREATURES_UNLOADED = 5038,
+    LANG_SERVER_RESPAWN_TIME_WRITES     = 5039,
+    LANG_SERVER_IDLE_CREATURE_UPDATES   = 5040,
+    LANG_MAP_CREATURE_UPDATES           = 5041,
+    LANG_SERVER_GRID_MEMORY             = 5042,
+    LANG_GRID_MEMORY_ENTRY              = 5043,
+    LANG_MAP_GRID_MEMORY                = 5044,
+    LANG_SERVER_HEAP_STATS              = 5045,
+    LANG_SERVER_HEAP_STATS_UNAVAILABLE  = 5046,
+    LANG_SERVER_POOL_STATS              = 5047,
+    LANG_SERVER_VISIBILITY_UPDATES      = 5048,
+    // Room for more Trinity strings      5049-9999
 
     // Level requirement notifications
     LANG_SAY_REQ                        = 6604,
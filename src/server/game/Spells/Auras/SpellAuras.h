@@ -21,6 +21,7 @@
 
 #include "SpellAuraDefines.h"
 #include "SpellInfo.h"
+#include "ObjectPool.h"
 #include "Unit.h"
 
 class Unit;
@@ -96,7 +97,7 @@ class AuraApplication
         void ClientUpdate(bool remove = false);
 };
 
-class Aura
+class Aura : public PooledObject
 {
     friend Aura* Unit::_TryStackingOrRefreshingExistingAura(SpellInfo const* newAura, uint8 effMask, Unit* caster, int32 *baseAmount, Item* castItem, uint64 casterGUID);
     public:
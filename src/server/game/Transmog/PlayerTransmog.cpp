@@ -16,7 +16,7 @@ void PlayerTransmog::LoadFromDB(PreparedQueryResult unlocked, PreparedQueryResul
             uint32 transmogID = field[0].GetUInt32();
 
             if (TransmogPartEntry const* part = sTransmogMgr->GetTransmogPartEntry(transmogID))
-                _unlockedTransmogs[part->Slot].insert(part->ID);
+                _unlockedTransmogs.Set(part->Index);
         }
         while (unlocked->NextRow());
     }
@@ -47,11 +47,11 @@ void PlayerTransmog::LoadFromDB(PreparedQueryResult unlocked, PreparedQueryResul
             {
                 if (TransmogSetEntry const* set = sTransmogMgr->GetTransmogSetEntry(part->Set))
                 {
-                    if (!set->Season && _unlockedTransmogs[part->Slot].find(part->ID) == _unlockedTransmogs[part->Slot].end())
+                    if (!set->Season && !IsUnlocked(part))
                         UnlockTransmog(part);
                 }
 
-                _historyTransmogs[part->Slot].insert(part->ID);
+                _historyTransmogs.Set(part->Index);
             }
         }
         while (history->NextRow());
@@ -110,7 +110,7 @@ uint32 PlayerTransmog::GetEntry(uint8 slot, Item* pItem) const
         {
             if (TransmogPartEntry const* entry = sTransmogMgr->GetTransmogPartEntry(itr->second))
             {
-                if (sTransmogMgr->Transmogrifiable(pItem->GetEntry(), entry->ItemEntry))
+                if (sTransmogMgr->Transmogrifiable(pItem->GetEntry(), entry))
                     return entry->ItemEntry;
             }
         }
@@ -141,9 +141,7 @@ bool PlayerTransmog::ActivateTransmog(Item* pItem, uint32 transmogID)
 
     TransmogPartEntry const* entry = sTransmogMgr->GetTransmogPartEntry(transmogID);
 
-    std::set<uint32>::iterator itr = _unlockedTransmogs[entry->Slot].find(transmogID);
-
-    if (itr != _unlockedTransmogs[entry->Slot].end())
+    if (entry && IsUnlocked(entry))
     {
         _activeTransmog[pItem->GetGUIDLow()] = transmogID;
         _changedActiveTransmogs.insert(pItem->GetGUIDLow());
@@ -156,45 +154,48 @@ bool PlayerTransmog::ActivateTransmog(Item* pItem, uint32 transmogID)
 
 void PlayerTransmog::UnlockTransmog(TransmogPartEntry const* part)
 {
-    _unlockedTransmogs[part->Slot].insert(part->ID);
+    _unlockedTransmogs.Set(part->Index);
     _newUnlockedTransmogs.insert(part->ID);
 
-    if (_historyTransmogs[part->Slot].find(part->ID) == _historyTransmogs[part->Slot].end())
+    if (!IsHistory(part))
     {
-        _historyTransmogs[part->Slot].insert(part->ID);
+        _historyTransmogs.Set(part->Index);
         _newHistoryTransmogs.insert(part->ID);
     }
+
+    // unlocking usually spends the items some conditions count
+    InvalidateConditionCache();
 }
 
-std::set<uint32> PlayerTransmog::GetUnlockedTransmogForSlot(uint8 slot) const
+void PlayerTransmog::GetUnlockedTransmogForSlot(uint8 slot, TransmogPartMask& unlocked) const
 {
     ASSERT(slot < EQUIPMENT_SLOT_END);
-    return _unlockedTransmogs[slot];
+    unlocked.AssignAnd(_unlockedTransmogs, sTransmogMgr->GetSlotParts(slot));
 }
 
-std::set<uint32> PlayerTransmog::GetAvailableSlots() const
+uint32 PlayerTransmog::GetAvailableSlots() const
 {
-    std::set<uint32> slots;
+    uint32 slots = 0;
 
     for (uint32 slot = 0; slot < EQUIPMENT_SLOT_END; ++slot)
     {
-        if (_unlockedTransmogs[slot].size())
-            slots.insert(slot);
-        else if (_historyTransmogs[slot].size())
-            slots.insert(slot);
+        TransmogPartMask const& slotParts = sTransmogMgr->GetSlotParts(slot);
+        if (_unlockedTransmogs.Intersects(slotParts) || _historyTransmogs.Intersects(slotParts))
+            slots |= 1 << slot;
     }
 
     return slots;
 }
 
-bool PlayerTransmog::IsUnlocked(uint32 transmogID, uint8 slot) const
+bool PlayerTransmog::IsMatchingCondition(uint32 conditionID) const
 {
-    return _unlockedTransmogs[slot].find(transmogID) != _unlockedTransmogs[slot].end();
-}
+    std::unordered_map<uint32, bool>::const_iterator itr = _conditionCache.find(conditionID);
+    if (itr != _conditionCache.end())
+        return itr->second;
 
-bool PlayerTransmog::IsHistory(uint32 transmogID, uint8 slot) const
-{
-    return _historyTransmogs[slot].find(transmogID) != _historyTransmogs[slot].end();
+    bool matching = TransmogCondition::IsMatchingCondition(_player, sTransmogMgr->GetTransmogCondition(conditionID));
+    _conditionCache[conditionID] = matching;
+    return matching;
 }
 
 uint32 PlayerTransmog::GetActiveTransmog(uint32 itemLowGUID) const
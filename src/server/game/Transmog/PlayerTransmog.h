@@ -23,11 +23,18 @@ public:
 
     void UnlockTransmog(TransmogPartEntry const* part);
 
-    std::set<uint32> GetUnlockedTransmogForSlot(uint8 slot) const;
-    std::set<uint32> GetAvailableSlots() const;
-
-    bool IsUnlocked(uint32 transmogID, uint8 slot) const;
-    bool IsHistory(uint32 transmogID, uint8 slot) const;
+    void GetUnlockedTransmogForSlot(uint8 slot, TransmogPartMask& unlocked) const;
+    // mask of (1 << slot)
+    uint32 GetAvailableSlots() const;
+    TransmogPartMask const& GetUnlockedMask() const { return _unlockedTransmogs; }
+    TransmogPartMask const& GetHistoryMask() const { return _historyTransmogs; }
+
+    bool IsUnlocked(TransmogPartEntry const* part) const { return _unlockedTransmogs.Test(part->Index); }
+    bool IsHistory(TransmogPartEntry const* part) const { return _historyTransmogs.Test(part->Index); }
+
+    // condition results are kept until the next InvalidateConditionCache(), done when the vendor is opened and on unlock
+    bool IsMatchingCondition(uint32 conditionID) const;
+    void InvalidateConditionCache() { _conditionCache.clear(); }
     uint32 GetActiveTransmog(uint32 itemLowGUID) const;
     ItemTransmogMap GetActiveTransmogs() const { return _activeTransmog; }
 
@@ -38,8 +45,9 @@ private:
     std::set<uint32> _newUnlockedTransmogs;
     std::set<uint32> _newHistoryTransmogs;
 
-    std::set<uint32> _unlockedTransmogs[EQUIPMENT_SLOT_END];
-    std::set<uint32> _historyTransmogs[EQUIPMENT_SLOT_END];
+    TransmogPartMask _unlockedTransmogs;
+    TransmogPartMask _historyTransmogs;
+    mutable std::unordered_map<uint32, bool> _conditionCache;
 
     ItemTransmogMap _activeTransmog;
 };
@@ -103,16 +103,88 @@ void TransmogMgr::LoadFromDB()
             if (entry->Condition && _transmogCostStorage.find(entry->RebuyCost) == _transmogCostStorage.end())
                 sLog->outError("RebuyCost %u used for part %u does not exist", entry->Condition, entry->ID);
 
+            if (entry->Slot >= EQUIPMENT_SLOT_END)
+            {
+                sLog->outError("Part %u uses invalid slot %u", entry->ID, entry->Slot);
+                delete entry;
+                continue;
+            }
+
+            entry->ItemSlot = GetSlot(entry->ItemEntry);
+
             _transmogPartEntryStorage[entry->ID] = entry;
-            _transmogPartEntrySlotIndex[entry->Slot].insert(entry);
             counter++;
         }
         while (result->NextRow());
 
+        // dense indices in ID order so masks iterate like the old sorted sets
+        for (std::map<uint32, TransmogPartEntry*>::const_iterator itr = _transmogPartEntryStorage.begin(); itr != _transmogPartEntryStorage.end(); ++itr)
+        {
+            TransmogPartEntry* entry = itr->second;
+            entry->Index = _transmogPartsByIndex.size();
+            _transmogPartsByIndex.push_back(entry);
+            _transmogPartEntrySlotIndex[entry->Slot].push_back(entry);
+            _transmogPartSlotMask[entry->Slot].Set(entry->Index);
+        }
+
         sLog->outString("Loaded %u transmog parts", counter);
     }
 }
 
+void TransmogPartMask::Set(uint32 index)
+{
+    if (index / 64 >= _words.size())
+        _words.resize(index / 64 + 1, 0);
+
+    _words[index / 64] |= uint64(1) << (index % 64);
+}
+
+void TransmogPartMask::AssignAnd(TransmogPartMask const& a, TransmogPartMask const& b)
+{
+    _words.assign(std::min(a._words.size(), b._words.size()), 0);
+
+    for (size_t i = 0; i < _words.size(); ++i)
+        _words[i] = a._words[i] & b._words[i];
+}
+
+void TransmogPartMask::OrAnd(TransmogPartMask const& a, TransmogPartMask const& b)
+{
+    size_t size = std::min(a._words.size(), b._words.size());
+    if (_words.size() < size)
+        _words.resize(size, 0);
+
+    for (size_t i = 0; i < size; ++i)
+        _words[i] |= a._words[i] & b._words[i];
+}
+
+bool TransmogPartMask::Intersects(TransmogPartMask const& other) const
+{
+    size_t size = std::min(_words.size(), other._words.size());
+
+    for (size_t i = 0; i < size; ++i)
+        if (_words[i] & other._words[i])
+            return true;
+
+    return false;
+}
+
+uint32 TransmogPartMask::Next(uint32 index) const
+{
+    uint32 start = index == npos ? 0 : index + 1;
+
+    for (size_t word = start / 64; word < _words.size(); ++word)
+    {
+        uint64 bits = _words[word];
+        if (word == start / 64)
+            bits &= ~uint64(0) << (start % 64);
+
+        if (bits)
+            return uint32(word * 64 + __builtin_ctzll(bits));
+    }
+
+    return npos;
+}
+
 TransmogSetEntry const* TransmogMgr::GetTransmogSetEntry(uint32 ID) const
 {
     std::map<uint32, TransmogSetEntry*>::const_iterator itr = _transmogSetEntryStorage.find(ID);
@@ -153,38 +225,39 @@ TransmogCost const* TransmogMgr::GetTransmogCost(uint32 ID) const
     return NULL;
 }
 
-void TransmogMgr::AddUnlockableSlots(Player* player, std::set<uint32> &slots) const
+void TransmogMgr::AddUnlockableSlots(Player* player, uint32 &slots) const
 {
     for (uint32 slot = 0; slot < EQUIPMENT_SLOT_END; ++slot)
     {
-        if (slots.end() == slots.find(slot) && _transmogPartEntrySlotIndex[slot].size())
+        if (!(slots & (1 << slot)) && !_transmogPartEntrySlotIndex[slot].empty())
         {
             bool insert = false;
 
-            for (std::set<TransmogPartEntry*>::const_iterator itr = _transmogPartEntrySlotIndex[slot].begin(); !insert && itr != _transmogPartEntrySlotIndex[slot].end(); ++itr)
+            for (std::vector<TransmogPartEntry const*>::const_iterator itr = _transmogPartEntrySlotIndex[slot].begin(); !insert && itr != _transmogPartEntrySlotIndex[slot].end(); ++itr)
                 if (isDisplayable(player, *itr))
                     insert = true;
 
             if (insert)
-                slots.insert(slot);
+                slots |= 1 << slot;
         }
     }
 }
 
-std::set<uint32> TransmogMgr::GetDisplayable(Player* player, uint32 slot) const
+void TransmogMgr::GetDisplayable(Player* player, uint32 slot, TransmogPartMask& displayables) const
 {
-    std::set<uint32> displayables;
+    displayables.Clear();
 
-    if (slot < EQUIPMENT_SLOT_END)
-    {
-        for (std::set<TransmogPartEntry*>::const_iterator itr = _transmogPartEntrySlotIndex[slot].begin(); itr != _transmogPartEntrySlotIndex[slot].end(); ++itr)
-        {
-            if (isDisplayable(player, *itr))
-                displayables.insert((*itr)->ID);
-        }
-    }
+    if (!player || slot >= EQUIPMENT_SLOT_END)
+        return;
 
-    return displayables;
+    // unlocked and history parts are always shown, only the rest needs the set and condition checks
+    PlayerTransmog const* transmog = player->GetTransmog();
+    displayables.AssignAnd(_transmogPartSlotMask[slot], transmog->GetUnlockedMask());
+    displayables.OrAnd(_transmogPartSlotMask[slot], transmog->GetHistoryMask());
+
+    for (std::vector<TransmogPartEntry const*>::const_iterator itr = _transmogPartEntrySlotIndex[slot].begin(); itr != _transmogPartEntrySlotIndex[slot].end(); ++itr)
+        if (!displayables.Test((*itr)->Index) && isDisplayable(player, *itr))
+            displayables.Set((*itr)->Index);
 }
 
 bool TransmogMgr::Transmogrifiable(uint32 itemEntry, uint32 transmogItemEntry) const
@@ -195,6 +268,11 @@ bool TransmogMgr::Transmogrifiable(uint32 itemEntry, uint32 transmogItemEntry) c
     return itemSlot == transmogSlot && itemSlot != NULL_SLOT;
 }
 
+bool TransmogMgr::Transmogrifiable(uint32 itemEntry, TransmogPartEntry const* part) const
+{
+    return part->ItemSlot != NULL_SLOT && GetSlot(itemEntry) == part->ItemSlot;
+}
+
 uint8 TransmogMgr::GetSlot(uint32 itemEntry) const
 {
     ItemTemplate const* itemProto = sObjectMgr->GetItemTemplate(itemEntry);
@@ -233,24 +311,21 @@ uint8 TransmogMgr::GetSlot(uint32 itemEntry) const
     }
 }
 
-bool TransmogMgr::isDisplayable(Player *player, TransmogPartEntry* entry) const
+bool TransmogMgr::isDisplayable(Player *player, TransmogPartEntry const* entry) const
 {
     if (!entry || !player)
        return false;
 
     PlayerTransmog const *transmog = player->GetTransmog();
 
-    if (transmog->IsUnlocked(entry->ID, entry->Slot) || transmog->IsHistory(entry->ID, entry->Slot))
+    if (transmog->IsUnlocked(entry) || transmog->IsHistory(entry))
         return true;
 
     if (TransmogSetEntry const* set = sTransmogMgr->GetTransmogSetEntry(entry->Set))
     {
         if (!set->Season || set->Season == sWorld->getIntConfig(CONFIG_ARENA_SEASON_TRANSMOG_ID))
         {
-            TransmogCondition const* entryCondition = sTransmogMgr->GetTransmogCondition(entry->Condition);
-            TransmogCondition const* setCondition = sTransmogMgr->GetTransmogCondition(set->Condition);
-
-            return TransmogCondition::IsMatchingCondition(player, entryCondition) && TransmogCondition::IsMatchingCondition(player, setCondition);
+            return transmog->IsMatchingCondition(entry->Condition) && transmog->IsMatchingCondition(set->Condition);
         }
     }
 
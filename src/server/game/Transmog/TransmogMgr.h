@@ -40,8 +40,10 @@ struct TransmogSetEntry
 struct TransmogPartEntry
 {
     uint32 ID;
+    uint32 Index;                                           // dense index in ID order, used by TransmogPartMask
     std::string Name;
     uint8 Slot;
+    uint8 ItemSlot;                                         // TransmogMgr::GetSlot(ItemEntry), resolved at load
     uint32 Set;
     uint32 ItemEntry;
     uint32 Cost;
@@ -49,6 +51,29 @@ struct TransmogPartEntry
     uint32 Condition;
 };
 
+// Set of transmog parts by TransmogPartEntry::Index
+class TransmogPartMask
+{
+public:
+    static uint32 const npos = 0xFFFFFFFF;
+
+    void Set(uint32 index);
+    bool Test(uint32 index) const { return index / 64 < _words.size() && (_words[index / 64] & (uint64(1) << (index % 64))) != 0; }
+    void Clear() { _words.clear(); }
+
+    // this = a & b, reusing the current storage
+    void AssignAnd(TransmogPartMask const& a, TransmogPartMask const& b);
+    // this |= a & b
+    void OrAnd(TransmogPartMask const& a, TransmogPartMask const& b);
+    bool Intersects(TransmogPartMask const& other) const;
+
+    // first set index after 'index' (or the first one for npos), npos if none
+    uint32 Next(uint32 index = npos) const;
+
+private:
+    std::vector<uint64> _words;
+};
+
 class TransmogMgr
 {
 public:
@@ -58,20 +83,26 @@ public:
     TransmogPartEntry const* GetTransmogPartEntry(uint32 ID) const;
     TransmogCondition const* GetTransmogCondition(uint32 ID) const;
     TransmogCost const* GetTransmogCost(uint32 ID) const;
+    TransmogPartEntry const* GetTransmogPartByIndex(uint32 index) const { return index < _transmogPartsByIndex.size() ? _transmogPartsByIndex[index] : NULL; }
+    TransmogPartMask const& GetSlotParts(uint8 slot) const { return _transmogPartSlotMask[slot]; }
 
-    void AddUnlockableSlots(Player* player, std::set<uint32> &slots) const;
-    std::set<uint32> GetDisplayable(Player* player, uint32 slot) const;
+    // slots is a mask of (1 << slot)
+    void AddUnlockableSlots(Player* player, uint32 &slots) const;
+    void GetDisplayable(Player* player, uint32 slot, TransmogPartMask& displayables) const;
 
     bool Transmogrifiable(uint32 itemEntry, uint32 transmogItemEntry) const;
+    bool Transmogrifiable(uint32 itemEntry, TransmogPartEntry const* part) const;
     uint8 GetSlot(uint32 itemEntry) const;
 
 private:
-    bool isDisplayable(Player *player, TransmogPartEntry* entry) const;
+    bool isDisplayable(Player *player, TransmogPartEntry const* entry) const;
 
     std::map<uint32, TransmogSetEntry*> _transmogSetEntryStorage;
     std::map<uint32, TransmogPartEntry*> _transmogPartEntryStorage;
 
-    std::set<TransmogPartEntry*> _transmogPartEntrySlotIndex[EQUIPMENT_SLOT_END];
+    std::vector<TransmogPartEntry const*> _transmogPartsByIndex;
+    std::vector<TransmogPartEntry const*> _transmogPartEntrySlotIndex[EQUIPMENT_SLOT_END];
+    TransmogPartMask _transmogPartSlotMask[EQUIPMENT_SLOT_END];
 
     std::map<uint32, TransmogCondition*> _transmogConditionStorage;
     std::map<uint32, TransmogCost*> _transmogCostStorage;
@@ -140,7 +140,9 @@ void Warden::Update()
                 RequestData();
                 // 25-35 second
                 uint32 holdOff = sWorld->getIntConfig(CONFIG_WARDEN_CLIENT_CHECK_HOLDOFF);
-                m_WardenCheckTimer = (holdOff < 1 ? 1 : holdOff) * IN_MILLISECONDS;
+                holdOff = (holdOff < 1 ? 1 : holdOff) * IN_MILLISECONDS;
+                // spread the next check by up to a quarter of the holdoff so sessions that logged in together drift apart
+                m_WardenCheckTimer = holdOff + urand(0, holdOff / 4);
             }
             else
                 m_WardenCheckTimer -= diff;
@@ -401,7 +403,7 @@ void Warden::RequestData()
             case PAGE_CHECK_A:
             case PAGE_CHECK_B:
             {
-                buff.append(wd->i.AsByteArray(0, false), wd->i.GetNumBytes());
+                buff.append(wd->iBytes.data(), wd->iBytes.size());
                 buff << uint32(wd->Address);
                 buff << uint8(wd->Length);
                 break;
@@ -414,7 +416,7 @@ void Warden::RequestData()
             }
             case DRIVER_CHECK:
             {
-                buff.append(wd->i.AsByteArray(0, false), wd->i.GetNumBytes());
+                buff.append(wd->iBytes.data(), wd->iBytes.size());
                 buff << uint8(index++);
                 break;
             }
@@ -430,7 +432,7 @@ void Warden::RequestData()
             }
             /*case PROC_CHECK:
             {
-                buff.append(wd->i.AsByteArray(0, false), wd->i.GetNumBytes());
+                buff.append(wd->iBytes.data(), wd->iBytes.size());
                 buff << uint8(index++);
                 buff << uint8(index++);
                 buff << uint32(wd->Address);
@@ -527,7 +529,7 @@ void Warden::HandleData(ByteBuffer &buff)
                     continue;
                 }
 
-                if (memcmp(buff.contents() + buff.rpos(), rs->res.AsByteArray(0, false), rd->Length) != 0)
+                if (rs->resBytes.size() < rd->Length || memcmp(buff.contents() + buff.rpos(), rs->resBytes.data(), rd->Length) != 0)
                 {
                     sout << "M " << *itr << " failed, ";
                     found = true;
@@ -594,7 +596,7 @@ void Warden::HandleData(ByteBuffer &buff)
                     continue;
                 }
 
-                if (memcmp(buff.contents() + buff.rpos(), rs->res.AsByteArray(0, false), 20) != 0) // SHA1
+                if (rs->resBytes.size() < 20 || memcmp(buff.contents() + buff.rpos(), rs->resBytes.data(), 20) != 0) // SHA1
                 {
                     sout << "Q " << *itr << " failed, ";
                     found = true;
@@ -782,6 +784,10 @@ void CWardenModuleStorage::LoadWardenDataResult()
                 std::reverse(temp, temp + len);
                 wd->i.SetBinary((uint8*)temp, len);
             }
+            // keep the full length of the stored value, AsByteArray(0) would drop its zero bytes
+            int size = std::max(len, wd->i.GetNumBytes());
+            uint8* bytes = wd->i.AsByteArray(size, false);
+            wd->iBytes.assign(bytes, bytes + size);
         }
 
         if (type == MEM_CHECK || type == MODULE_CHECK)
@@ -814,6 +820,10 @@ void CWardenModuleStorage::LoadWardenDataResult()
                 wr->res.SetBinary((uint8*)temp, len);
                 delete [] temp;
             }
+            // padded to the number of bytes HandleData compares: the check length, or a SHA1 digest for MPQ checks
+            int size = std::max(std::max(len, wr->res.GetNumBytes()), type == MEM_CHECK ? int(wd->Length) : 20);
+            uint8* bytes = wr->res.AsByteArray(size, false);
+            wr->resBytes.assign(bytes, bytes + size);
             _result_map[id] = wr;
         }
     } while (result->NextRow());
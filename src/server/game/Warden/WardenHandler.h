@@ -21,6 +21,7 @@
 
 #include "ARC4.h"
 #include <map>
+#include <vector>
 #include "BigNumber.h"
 #include "ByteBuffer.h"
 
@@ -131,6 +132,7 @@ struct WardenData
 {
     uint8 Type;
     BigNumber i;
+    std::vector<uint8> iBytes;                              // i as sent to the client, BigNumber::AsByteArray is not safe to share
     uint32 Address;                                         // PROC_CHECK, MEM_CHECK, PAGE_CHECK
     uint8 Length;                                           // PROC_CHECK, MEM_CHECK, PAGE_CHECK
     std::string str;                                        // LUA, MPQ, DRIVER
@@ -139,6 +141,7 @@ struct WardenData
 struct WardenDataResult
 {
     BigNumber res;                                          // MEM_CHECK
+    std::vector<uint8> resBytes;                            // res as compared with the client reply
 };
 
 class WorldSession;
@@ -121,6 +121,22 @@ World::World() : m_customArenaResetTimer(NULL)
 
     m_updateTimeSum = 0;
     m_updateTimeCount = 0;
+    m_droppedLocalChat = 0;
+    m_savedWorldStatePackets = 0;
+    m_batchedMovementRelays = 0;
+    m_batchedMovementPackets = 0;
+    m_batchedMovementBytes = 0;
+    m_creaturesAwaitingRespawn = 0;
+    m_queuedRespawns = 0;
+    m_respawnTimeWrites = 0;
+    m_respawnTimeTransactions = 0;
+    m_creatureUpdates = 0;
+    m_skippedCreatureUpdates = 0;
+    m_loadedGrids = 0;
+    m_gridTerrainMemory = 0;
+    m_visibilityCreates = 0;
+    m_visibilityDestroys = 0;
+    m_deferredVisibilityCreates = 0;
 
     m_isClosed = false;
 
@@ -622,6 +638,8 @@ void World::LoadConfigSettings(bool reload)
     if (reload)
         sMapMgr->SetGridCleanUpDelay(m_int_configs[CONFIG_INTERVAL_GRIDCLEAN]);
 
+    m_int_configs[CONFIG_GRID_UNLOAD_MEMORY_LIMIT] = ConfigMgr::GetIntDefault("GridUnload.MemoryLimit", 0);
+
     m_int_configs[CONFIG_INTERVAL_MAPUPDATE] = ConfigMgr::GetIntDefault("MapUpdateInterval", 100);
     if (m_int_configs[CONFIG_INTERVAL_MAPUPDATE] < MIN_MAP_UPDATE_DELAY)
     {
@@ -963,6 +981,8 @@ void World::LoadConfigSettings(bool reload)
     }
 
     m_bool_configs[CONFIG_SAVE_RESPAWN_TIME_IMMEDIATELY] = ConfigMgr::GetBoolDefault("SaveRespawnTimeImmediately", true);
+    m_bool_configs[CONFIG_RESPAWN_UNLOAD_DEAD_CREATURES] = ConfigMgr::GetBoolDefault("Respawn.UnloadDeadCreatures", true);
+    m_int_configs[CONFIG_INTERVAL_RESPAWN_SAVE] = ConfigMgr::GetIntDefault("Respawn.SaveInterval", 5) * IN_MILLISECONDS;
     m_bool_configs[CONFIG_WEATHER] = ConfigMgr::GetBoolDefault("ActivateWeather", true);
 
     m_int_configs[CONFIG_DISABLE_BREATHING] = ConfigMgr::GetIntDefault("DisableWaterBreath", SEC_CONSOLE);
@@ -981,13 +1001,25 @@ void World::LoadConfigSettings(bool reload)
     m_int_configs[CONFIG_CHATFLOOD_MESSAGE_COUNT] = ConfigMgr::GetIntDefault("ChatFlood.MessageCount", 10);
     m_int_configs[CONFIG_CHATFLOOD_MESSAGE_DELAY] = ConfigMgr::GetIntDefault("ChatFlood.MessageDelay", 1);
     m_int_configs[CONFIG_CHATFLOOD_MUTE_TIME]     = ConfigMgr::GetIntDefault("ChatFlood.MuteTime", 10);
+    m_int_configs[CONFIG_CHATFLOOD_LOCAL_RATE]    = ConfigMgr::GetIntDefault("ChatFlood.LocalMessageRate", 0);
+    m_int_configs[CONFIG_CHATFLOOD_LOCAL_BURST]   = ConfigMgr::GetIntDefault("ChatFlood.LocalMessageBurst", 5);
+    if (m_int_configs[CONFIG_CHATFLOOD_LOCAL_BURST] < 1)
+    {
+        sLog->outError("ChatFlood.LocalMessageBurst (%u) must be >= 1. Using 1 instead.", m_int_configs[CONFIG_CHATFLOOD_LOCAL_BURST]);
+        m_int_configs[CONFIG_CHATFLOOD_LOCAL_BURST] = 1;
+    }
+
+    m_bool_configs[CONFIG_MOVEMENT_BATCHING] = ConfigMgr::GetBoolDefault("Movement.Batching", false);
+    m_int_configs[CONFIG_MOVEMENT_BATCHING_COMPRESS_SIZE] = ConfigMgr::GetIntDefault("Movement.BatchingCompressSize", 500);
 
     m_int_configs[CONFIG_EVENT_ANNOUNCE] = ConfigMgr::GetIntDefault("Event.Announce", 0);
+    m_int_configs[CONFIG_EVENT_SPAWNS_PER_MAP_UPDATE] = ConfigMgr::GetIntDefault("Event.SpawnsPerMapUpdate", 100);
 
     m_float_configs[CONFIG_CREATURE_FAMILY_FLEE_ASSISTANCE_RADIUS] = ConfigMgr::GetFloatDefault("CreatureFamilyFleeAssistanceRadius", 30.0f);
     m_float_configs[CONFIG_CREATURE_FAMILY_ASSISTANCE_RADIUS] = ConfigMgr::GetFloatDefault("CreatureFamilyAssistanceRadius", 10.0f);
     m_int_configs[CONFIG_CREATURE_FAMILY_ASSISTANCE_DELAY]  = ConfigMgr::GetIntDefault("CreatureFamilyAssistanceDelay", 1500);
     m_int_configs[CONFIG_CREATURE_FAMILY_FLEE_DELAY]        = ConfigMgr::GetIntDefault("CreatureFamilyFleeDelay", 7000);
+    m_int_configs[CONFIG_CREATURE_IDLE_UPDATE_INTERVAL]     = ConfigMgr::GetIntDefault("CreatureIdleUpdateInterval", 500);
 
     m_int_configs[CONFIG_WORLD_BOSS_LEVEL_DIFF] = ConfigMgr::GetIntDefault("WorldBossLevelDiff", 3);
 
@@ -1053,6 +1085,7 @@ void World::LoadConfigSettings(bool reload)
     m_int_configs[CONFIG_ARENA_MAX_RATING_DIFFERENCE]                = ConfigMgr::GetIntDefault ("Arena.MaxRatingDifference", 150);
     m_int_configs[CONFIG_ARENA_RATING_DISCARD_TIMER]                 = ConfigMgr::GetIntDefault ("Arena.RatingDiscardTimer", 10 * MINUTE * IN_MILLISECONDS);
     m_int_configs[CONFIG_ARENA_RATED_UPDATE_TIMER]                   = ConfigMgr::GetIntDefault ("Arena.RatedUpdateTimer", 5 * IN_MILLISECONDS);
+    m_int_configs[CONFIG_MATCHMAKING_UPDATE_BUDGET]                  = ConfigMgr::GetIntDefault ("Matchmaking.UpdateBudget", 0);
     m_bool_configs[CONFIG_ARENA_AUTO_DISTRIBUTE_POINTS]              = ConfigMgr::GetBoolDefault("Arena.AutoDistributePoints", false);
     m_int_configs[CONFIG_ARENA_AUTO_DISTRIBUTE_INTERVAL_DAYS]        = ConfigMgr::GetIntDefault ("Arena.AutoDistributeInterval", 7);
     m_bool_configs[CONFIG_ARENA_QUEUE_ANNOUNCER_ENABLE]              = ConfigMgr::GetBoolDefault("Arena.QueueAnnouncer.Enable", false);
@@ -1131,6 +1164,14 @@ void World::LoadConfigSettings(bool reload)
     m_visibility_notify_periodInInstances = ConfigMgr::GetIntDefault("Visibility.Notify.Period.InInstances",   DEFAULT_VISIBILITY_NOTIFY_PERIOD);
     m_visibility_notify_periodInBGArenas = ConfigMgr::GetIntDefault("Visibility.Notify.Period.InBGArenas",    DEFAULT_VISIBILITY_NOTIFY_PERIOD);
 
+    m_float_configs[CONFIG_VISIBILITY_LEAVE_MARGIN] = ConfigMgr::GetFloatDefault("Visibility.LeaveMargin", 10.0f);
+    if (m_float_configs[CONFIG_VISIBILITY_LEAVE_MARGIN] < 0.0f)
+    {
+        sLog->outError("Visibility.LeaveMargin (%f) must be >= 0. Using 0 instead.", m_float_configs[CONFIG_VISIBILITY_LEAVE_MARGIN]);
+        m_float_configs[CONFIG_VISIBILITY_LEAVE_MARGIN] = 0.0f;
+    }
+    m_int_configs[CONFIG_VISIBILITY_CREATES_PER_UPDATE] = ConfigMgr::GetIntDefault("Visibility.CreatesPerUpdate", 0);
+
     ///- Load the CharDelete related config options
     m_int_configs[CONFIG_CHARDELETE_METHOD] = ConfigMgr::GetIntDefault("CharDelete.Method", 0);
     m_int_configs[CONFIG_CHARDELETE_MIN_LEVEL] = ConfigMgr::GetIntDefault("CharDelete.MinLevel", 0);
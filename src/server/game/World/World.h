@@ -113,6 +113,7 @@ enum WorldBoolConfigs
     CONFIG_SKILL_PROSPECTING,
     CONFIG_SKILL_MILLING,
     CONFIG_SAVE_RESPAWN_TIME_IMMEDIATELY,
+    CONFIG_RESPAWN_UNLOAD_DEAD_CREATURES,
     CONFIG_WEATHER,
     CONFIG_ALWAYS_MAX_SKILL_FOR_LEVEL,
     CONFIG_QUEST_IGNORE_RAID,
@@ -171,6 +172,7 @@ enum WorldBoolConfigs
     CONFIG_RAID_FINDER_ENABLE,
     CONFIG_CUSTOM_ICC_BUFF_PLAYERCHOOSE,
     CONFIG_CUSTOM_GM_QUALITY_MANAGER,
+    CONFIG_MOVEMENT_BATCHING,
     BOOL_CONFIG_VALUE_COUNT
 };
 
@@ -187,6 +189,7 @@ enum WorldFloatConfigs
     CONFIG_CREATURE_FAMILY_ASSISTANCE_RADIUS,
     CONFIG_THREAT_RADIUS,
     CONFIG_CHANCE_OF_GM_SURVEY,
+    CONFIG_VISIBILITY_LEAVE_MARGIN,
     FLOAT_CONFIG_VALUE_COUNT
 };
 
@@ -195,6 +198,8 @@ enum WorldIntConfigs
     CONFIG_COMPRESSION = 0,
     CONFIG_INTERVAL_SAVE,
     CONFIG_INTERVAL_GRIDCLEAN,
+    CONFIG_GRID_UNLOAD_MEMORY_LIMIT,
+    CONFIG_INTERVAL_RESPAWN_SAVE,
     CONFIG_INTERVAL_MAPUPDATE,
     CONFIG_INTERVAL_CHANGEWEATHER,
     CONFIG_INTERVAL_DISCONNECT_TOLERANCE,
@@ -241,6 +246,7 @@ enum WorldIntConfigs
     CONFIG_GM_LEVEL_IN_WHO_LIST,
     CONFIG_START_GM_LEVEL,
     CONFIG_GROUP_VISIBILITY,
+    CONFIG_VISIBILITY_CREATES_PER_UPDATE,
     CONFIG_MAIL_DELIVERY_DELAY,
     CONFIG_UPTIME_UPDATE,
     CONFIG_SKILL_CHANCE_ORANGE,
@@ -258,9 +264,14 @@ enum WorldIntConfigs
     CONFIG_CHATFLOOD_MESSAGE_COUNT,
     CONFIG_CHATFLOOD_MESSAGE_DELAY,
     CONFIG_CHATFLOOD_MUTE_TIME,
+    CONFIG_CHATFLOOD_LOCAL_RATE,
+    CONFIG_CHATFLOOD_LOCAL_BURST,
+    CONFIG_MOVEMENT_BATCHING_COMPRESS_SIZE,
     CONFIG_EVENT_ANNOUNCE,
+    CONFIG_EVENT_SPAWNS_PER_MAP_UPDATE,
     CONFIG_CREATURE_FAMILY_ASSISTANCE_DELAY,
     CONFIG_CREATURE_FAMILY_FLEE_DELAY,
+    CONFIG_CREATURE_IDLE_UPDATE_INTERVAL,
     CONFIG_WORLD_BOSS_LEVEL_DIFF,
     CONFIG_QUEST_LOW_LEVEL_HIDE_DIFF,
     CONFIG_QUEST_HIGH_LEVEL_HIDE_DIFF,
@@ -287,6 +298,7 @@ enum WorldIntConfigs
     CONFIG_ARENA_MAX_RATING_DIFFERENCE,
     CONFIG_ARENA_RATING_DISCARD_TIMER,
     CONFIG_ARENA_RATED_UPDATE_TIMER,
+    CONFIG_MATCHMAKING_UPDATE_BUDGET,
     CONFIG_ARENA_AUTO_DISTRIBUTE_INTERVAL_DAYS,
     CONFIG_ARENA_SEASON_ID,
     CONFIG_ARENA_SEASON_TRANSMOG_ID,
@@ -675,6 +687,46 @@ class World
         uint32 GetUptime() const { return uint32(m_gameTime - m_startTime); }
         /// Update time
         uint32 GetUpdateTime() const { return m_updateTime; }
+        /// Say/yell/emote messages dropped by the local chat rate limit
+        uint32 GetDroppedLocalChatCount() const { return m_droppedLocalChat; }
+        void IncreaseDroppedLocalChatCount() { ++m_droppedLocalChat; }
+        /// World state packets not sent because a later value for the same field replaced them in the same tick
+        uint32 GetSavedWorldStatePacketCount() const { return m_savedWorldStatePackets.load(); }
+        void IncreaseSavedWorldStatePacketCount(uint32 count) { m_savedWorldStatePackets += count; }
+        /// Movement relays queued for batching and the packets/bytes they were sent in
+        uint32 GetBatchedMovementRelayCount() const { return m_batchedMovementRelays.load(); }
+        uint32 GetBatchedMovementPacketCount() const { return m_batchedMovementPackets.load(); }
+        uint64 GetBatchedMovementByteCount() const { return m_batchedMovementBytes.load(); }
+        /// Dead creatures deleted until their respawn and the respawn time writes sent to the DB
+        uint32 GetCreaturesAwaitingRespawnCount() const { return m_creaturesAwaitingRespawn.load(); }
+        void ModifyCreaturesAwaitingRespawnCount(int32 count) { m_creaturesAwaitingRespawn += count; }
+        uint32 GetQueuedRespawnCount() const { return m_queuedRespawns.load(); }
+        void IncreaseQueuedRespawnCount() { ++m_queuedRespawns; }
+        uint32 GetRespawnTimeWriteCount() const { return m_respawnTimeWrites.load(); }
+        uint32 GetRespawnTimeTransactionCount() const { return m_respawnTimeTransactions.load(); }
+        void AddRespawnTimeTransaction(uint32 writes) { m_respawnTimeWrites += writes; ++m_respawnTimeTransactions; }
+        /// Creature updates done and skipped by the idle update interval
+        uint64 GetCreatureUpdateCount() const { return m_creatureUpdates.load(); }
+        uint64 GetSkippedCreatureUpdateCount() const { return m_skippedCreatureUpdates.load(); }
+        void AddCreatureUpdates(uint32 updates, uint32 skipped) { m_creatureUpdates += updates; m_skippedCreatureUpdates += skipped; }
+        /// Loaded grids of all maps and the bytes of their terrain data
+        uint32 GetLoadedGridCount() const { return m_loadedGrids.load(); }
+        void ModifyLoadedGridCount(int32 count) { m_loadedGrids += count; }
+        uint64 GetGridTerrainMemory() const { return m_gridTerrainMemory.load(); }
+        void ModifyGridTerrainMemory(int64 bytes) { m_gridTerrainMemory += bytes; }
+        /// Objects created at and removed from clients by visibility updates, and creations put off to a later update
+        uint64 GetVisibilityCreateCount() const { return m_visibilityCreates.load(); }
+        uint64 GetVisibilityDestroyCount() const { return m_visibilityDestroys.load(); }
+        uint64 GetDeferredVisibilityCreateCount() const { return m_deferredVisibilityCreates.load(); }
+        void IncreaseVisibilityCreateCount() { ++m_visibilityCreates; }
+        void AddVisibilityDestroys(uint32 count) { m_visibilityDestroys += count; }
+        void IncreaseDeferredVisibilityCreateCount() { ++m_deferredVisibilityCreates; }
+        void AddBatchedMovementPacket(uint32 relays, uint32 bytes)
+        {
+            m_batchedMovementRelays += relays;
+            ++m_batchedMovementPackets;
+            m_batchedMovementBytes += bytes;
+        }
         void SetRecordDiffInterval(int32 t) { if (t >= 0) m_int_configs[CONFIG_INTERVAL_LOG_UPDATE] = (uint32)t; }
 
         /// Next daily quests and random bg reset time
@@ -852,6 +904,22 @@ class World
         time_t mail_timer_expires;
         uint32 m_updateTime, m_updateTimeSum;
         uint32 m_updateTimeCount;
+        uint32 m_droppedLocalChat;
+        std::atomic<uint32> m_savedWorldStatePackets;       // battlegrounds flush from their map threads
+        std::atomic<uint32> m_batchedMovementRelays;        // movement relays are flushed from the map threads
+        std::atomic<uint32> m_batchedMovementPackets;
+        std::atomic<uint64> m_batchedMovementBytes;
+        std::atomic<int32> m_creaturesAwaitingRespawn;      // changed by the maps from their threads
+        std::atomic<uint32> m_queuedRespawns;
+        std::atomic<uint32> m_respawnTimeWrites;
+        std::atomic<uint32> m_respawnTimeTransactions;
+        std::atomic<uint64> m_creatureUpdates;
+        std::atomic<uint64> m_skippedCreatureUpdates;
+        std::atomic<int32> m_loadedGrids;                   // grids are loaded and unloaded by the map threads
+        std::atomic<int64> m_gridTerrainMemory;
+        std::atomic<uint64> m_visibilityCreates;            // visibility is updated from the map threads
+        std::atomic<uint64> m_visibilityDestroys;
+        std::atomic<uint64> m_deferredVisibilityCreates;
         uint32 m_currentTime;
         uint32 m_lastDiminishingReturnReset;
         CustomArenaResetTimer* m_customArenaResetTimer;
@@ -268,7 +268,7 @@ void ClientSession::HandlePlayerLoginOpcode(WorldPacket & recv_data)
 
     m_loginDelay = LOGON_LOGIN_DELAY;
 
-    _charLoginCallback = CharacterDatabase.DelayQueryHolder((SQLQueryHolder*)holder);
+    _charLoginCallback = CharacterDatabase.DelayQueryHolder((SQLQueryHolder*)holder, true);
 }
 
 void ClientSession::HandlePlayerLogin(LoginQueryHolder * holder)
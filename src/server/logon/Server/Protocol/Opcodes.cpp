@@ -1336,7 +1336,7 @@ OpcodeHandler opcodeTable[NUM_MSG_TYPES] =
     /*0x51B*/ { "CMSG_COMMENTATOR_SKIRMISH_QUEUE_COMMAND",      true,   STATUS_NEVER,       PACKET_STATE_NODE,  PACKET_STATE_PASS,  &ClientSession::Handle_NULL                     },
     /*0x51C*/ { "SMSG_COMMENTATOR_SKIRMISH_QUEUE_RESULT1",      true,   STATUS_NEVER,       PACKET_STATE_NODE,  PACKET_STATE_PASS,  &ClientSession::Handle_ServerSide               },
     /*0x51D*/ { "SMSG_COMMENTATOR_SKIRMISH_QUEUE_RESULT2",      true,   STATUS_NEVER,       PACKET_STATE_NODE,  PACKET_STATE_PASS,  &ClientSession::Handle_ServerSide               },
-    /*0x51E*/ { "SMSG_UNKNOWN_1310",                            true,   STATUS_NEVER,       PACKET_STATE_NODE,  PACKET_STATE_PASS,  &ClientSession::Handle_ServerSide               },
+    /*0x51E*/ { "SMSG_MULTIPLE_MOVES",                          true,   STATUS_NEVER,       PACKET_STATE_NODE,  PACKET_STATE_PASS,  &ClientSession::Handle_ServerSide               },
     /*0x51F*/ { "NUM_CLIENT_MSG_TYPES",                         true,   STATUS_NEVER,       PACKET_STATE_NULL,  PACKET_STATE_NULL,  &ClientSession::Handle_NULL                     },
     /*0x520*/ { "LOGON_AUTH_MASTER",                            true,   STATUS_NEVER,       PACKET_STATE_NULL,  PACKET_STATE_NULL,  &ClientSession::Handle_ServerSide               },
     /*0x521*/ { "LOGON_NODE_INIT",                              true,   STATUS_NEVER,       PACKET_STATE_NULL,  PACKET_STATE_NULL,  &ClientSession::Handle_ServerSide               },
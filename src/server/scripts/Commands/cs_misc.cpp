@@ -295,6 +295,8 @@ public:
         if (status)
             handler->PSendSysMessage(LANG_LIQUID_STATUS, liquidStatus.level, liquidStatus.depth_level, liquidStatus.entry, liquidStatus.type_flags, status);
 
+        handler->PSendSysMessage(LANG_MAP_CREATURE_UPDATES, map->GetCreatureUpdateCount(), map->GetSkippedCreatureUpdateCount());
+
         if (Transport* pTransport = object->GetTransport())
         {
             Position objectPosition;
@@ -505,6 +505,7 @@ public:
             sObjectMgr->CheckCreatureTemplate(cInfo);
         }
 
+        sObjectMgr->ClearQueryResponses(QUERY_RESPONSE_CREATURE);
         handler->SendGlobalGMSysMessage("Creature template reloaded.");
         return true;
     }
@@ -579,6 +580,7 @@ public:
     {
         sLog->outString("Re-Loading Quest Templates...");
         sObjectMgr->LoadQuests();
+        sObjectMgr->ClearQueryResponses(QUERY_RESPONSE_QUEST);
         handler->SendGlobalGMSysMessage("DB table `quest_template` (quest definitions) reloaded.");
 
         /// dependent also from `gameobject` but this table not reloaded anyway
@@ -1175,6 +1177,7 @@ public:
     {
         sLog->outString("Re-Loading Locales Creature ...");
         sObjectMgr->LoadCreatureLocales();
+        sObjectMgr->ClearQueryResponses(QUERY_RESPONSE_CREATURE);
         handler->SendGlobalGMSysMessage("DB table `locales_creature` reloaded.");
         return true;
     }
@@ -1191,6 +1194,7 @@ public:
     {
         sLog->outString("Re-Loading Locales Gameobject ... ");
         sObjectMgr->LoadGameObjectLocales();
+        sObjectMgr->ClearQueryResponses(QUERY_RESPONSE_GAMEOBJECT);
         handler->SendGlobalGMSysMessage("DB table `locales_gameobject` reloaded.");
         return true;
     }
@@ -1207,6 +1211,7 @@ public:
     {
         sLog->outString("Re-Loading Locales Item ... ");
         sObjectMgr->LoadItemLocales();
+        sObjectMgr->ClearQueryResponses(QUERY_RESPONSE_ITEM);
         handler->SendGlobalGMSysMessage("DB table `locales_item` reloaded.");
         return true;
     }
@@ -1247,6 +1252,7 @@ public:
     {
         sLog->outString("Re-Loading Locales Quest ... ");
         sObjectMgr->LoadQuestLocales();
+        sObjectMgr->ClearQueryResponses(QUERY_RESPONSE_QUEST);
         handler->SendGlobalGMSysMessage("DB table `locales_quest` reloaded.");
         return true;
     }
@@ -27,6 +27,8 @@ EndScriptData */
 #include "SystemConfig.h"
 #include "Config.h"
 #include "ObjectAccessor.h"
+#include "VMapFactory.h"
+#include "ObjectPool.h"
 
 class server_commandscript : public CommandScript
 {
@@ -75,8 +77,10 @@ public:
 
         static ChatCommand serverCommandTable[] =
         {
+            { "allocator",      SEC_GAMEMASTER,     true,  &HandleServerAllocatorCommand,           "", NULL },
             { "corpses",        SEC_GAMEMASTER,     true,  &HandleServerCorpsesCommand,             "", NULL },
             { "exit",           SEC_CONSOLE,        true,  &HandleServerExitCommand,                "", NULL },
+            { "gridmemory",     SEC_GAMEMASTER,     true,  &HandleServerGridMemoryCommand,          "", NULL },
             { "idlerestart",    SEC_ADMINISTRATOR,  true,  NULL,                                    "", serverIdleRestartCommandTable },
             { "idleshutdown",   SEC_ADMINISTRATOR,  true,  NULL,                                    "", serverIdleShutdownCommandTable },
             { "info",           SEC_PLAYER,         true,  &HandleServerInfoCommand,                "", NULL },
@@ -104,6 +108,58 @@ public:
         return true;
     }
 
+    // Heap statistics and the object pool free lists
+    static bool HandleServerAllocatorCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        HeapStats heapStats;
+        if (ObjectPool::GetHeapStats(heapStats))
+            handler->PSendSysMessage(LANG_SERVER_HEAP_STATS, uint32(heapStats.Allocated / 1024), uint32(heapStats.Active / 1024), uint32(heapStats.Mapped / 1024));
+        else
+            handler->SendSysMessage(LANG_SERVER_HEAP_STATS_UNAVAILABLE);
+
+        std::vector<ObjectPoolStats> pools;
+        ObjectPool::GetStats(pools);
+        for (std::vector<ObjectPoolStats>::const_iterator itr = pools.begin(); itr != pools.end(); ++itr)
+            handler->PSendSysMessage(LANG_SERVER_POOL_STATS, uint32(itr->BlockSize), itr->LiveBlocks, itr->FreeBlocks, double(itr->Allocations),
+                itr->Allocations ? float(itr->Reuses) * 100.0f / itr->Allocations : 0.0f);
+        return true;
+    }
+
+    // Memory held by loaded grids, in game also per grid of the current map
+    static bool HandleServerGridMemoryCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        uint64 modelBytes = VMAP::VMapFactory::createOrGetVMapManager()->getLoadedModelMemoryUsage();
+        handler->PSendSysMessage(LANG_SERVER_GRID_MEMORY, sWorld->GetLoadedGridCount(), uint32(Map::GetLoadedGridMemoryUsage() / 1024),
+            uint32(sWorld->GetGridTerrainMemory() / 1024), uint32(modelBytes / 1024),
+            sWorld->getIntConfig(CONFIG_GRID_UNLOAD_MEMORY_LIMIT));
+
+        Player* player = handler->GetSession() ? handler->GetSession()->GetPlayer() : NULL;
+        if (!player)
+            return true;
+
+        static char const* stateNames[MAX_GRID_STATE] = { "invalid", "active", "idle", "removal" };
+
+        Map* map = player->GetMap();
+        std::vector<GridMemoryUsage> grids;
+        map->GetGridMemoryUsage(grids);
+
+        time_t now = time(NULL);
+        uint64 objectBytes = 0, terrainBytes = 0, vmapBytes = 0;
+        for (std::vector<GridMemoryUsage>::const_iterator itr = grids.begin(); itr != grids.end(); ++itr)
+        {
+            handler->PSendSysMessage(LANG_GRID_MEMORY_ENTRY, itr->GridX, itr->GridY, stateNames[itr->State], uint32(now - itr->LastActiveTime),
+                itr->Creatures, itr->GameObjects, itr->Players, itr->OtherObjects,
+                uint32(itr->ObjectBytes / 1024), uint32(itr->TerrainBytes / 1024), uint32(itr->VMapBytes / 1024));
+            objectBytes += itr->ObjectBytes;
+            terrainBytes += itr->TerrainBytes;
+            vmapBytes += itr->VMapBytes;
+        }
+
+        handler->PSendSysMessage(LANG_MAP_GRID_MEMORY, map->GetId(), map->GetInstanceId(), uint32(grids.size()),
+            uint32(objectBytes / 1024), uint32(terrainBytes / 1024), uint32(vmapBytes / 1024));
+        return true;
+    }
+
     static bool HandleServerInfoCommand(ChatHandler* handler, char const* /*args*/)
     {
         uint32 playersNum           = sWorld->GetPlayerCount();
@@ -120,6 +176,31 @@ public:
         handler->PSendSysMessage(LANG_CONNECTED_USERS, activeClientsNum, maxActiveClientsNum, queuedClientsNum, maxQueuedClientsNum);
         handler->PSendSysMessage(LANG_UPTIME, uptime.c_str());
         handler->PSendSysMessage(LANG_UPDATE_DIFF, updateTime);
+        if (sWorld->getIntConfig(CONFIG_CHATFLOOD_LOCAL_RATE))
+            handler->PSendSysMessage(LANG_SERVER_LOCAL_CHAT_DROPPED, sWorld->GetDroppedLocalChatCount());
+        if (uint32 savedWorldStates = sWorld->GetSavedWorldStatePacketCount())
+            handler->PSendSysMessage(LANG_SERVER_WORLD_STATES_SAVED, savedWorldStates);
+        if (sWorld->getBoolConfig(CONFIG_RESPAWN_UNLOAD_DEAD_CREATURES))
+            handler->PSendSysMessage(LANG_SERVER_DEAD_CREATURES_UNLOADED,
+                sWorld->GetCreaturesAwaitingRespawnCount(), uint32(sWorld->GetCreaturesAwaitingRespawnCount() * sizeof(Creature) / 1024), sWorld->GetQueuedRespawnCount());
+        if (uint32 respawnTransactions = sWorld->GetRespawnTimeTransactionCount())
+            handler->PSendSysMessage(LANG_SERVER_RESPAWN_TIME_WRITES, sWorld->GetRespawnTimeWriteCount(), respawnTransactions);
+        if (uint64 skippedUpdates = sWorld->GetSkippedCreatureUpdateCount())
+            handler->PSendSysMessage(LANG_SERVER_IDLE_CREATURE_UPDATES, double(skippedUpdates), double(skippedUpdates + sWorld->GetCreatureUpdateCount()));
+        if (uint32 movementPackets = sWorld->GetBatchedMovementPacketCount())
+        {
+            uint32 seconds = std::max<uint32>(sWorld->GetUptime(), 1);
+            uint64 movementBytes = sWorld->GetBatchedMovementByteCount();
+            handler->PSendSysMessage(LANG_SERVER_MOVEMENT_RELAYS, sWorld->GetBatchedMovementRelayCount(),
+                movementPackets, float(movementPackets) / seconds, float(movementBytes) / seconds);
+        }
+        if (uint64 visibilityCreates = sWorld->GetVisibilityCreateCount())
+        {
+            uint32 seconds = std::max<uint32>(sWorld->GetUptime(), 1);
+            uint64 visibilityDestroys = sWorld->GetVisibilityDestroyCount();
+            handler->PSendSysMessage(LANG_SERVER_VISIBILITY_UPDATES, double(visibilityCreates), float(visibilityCreates) / seconds,
+                double(visibilityDestroys), float(visibilityDestroys) / seconds, double(sWorld->GetDeferredVisibilityCreateCount()));
+        }
         // Can't use sWorld->ShutdownMsg here in case of console command
         if (sWorld->IsShuttingDown())
             handler->PSendSysMessage(LANG_SHUTDOWN_TIMELEFT, secsToTimeString(sWorld->GetShutDownTimeLeft()).c_str());
@@ -63,15 +63,19 @@ public:
         if (!transmog)
             return false;
 
-        std::set<uint32> slots = transmog->GetAvailableSlots();
+        uint32 slots = transmog->GetAvailableSlots();
+        TransmogPartMask transmogs;
 
-        for (std::set<uint32>::iterator itr = slots.begin(); itr != slots.end(); ++itr)
+        for (uint32 slot = 0; slot < EQUIPMENT_SLOT_END; ++slot)
         {
-            std::set<uint32> transmogs = transmog->GetUnlockedTransmogForSlot(*itr);
-            handler->PSendSysMessage("Unlocked transmogs for slot %u:", *itr);
+            if (!(slots & (1 << slot)))
+                continue;
 
-            for (std::set<uint32>::iterator itr2 = transmogs.begin(); itr2 != transmogs.end(); ++itr2)
-                handler->PSendSysMessage("|- %u", *itr2);
+            transmog->GetUnlockedTransmogForSlot(slot, transmogs);
+            handler->PSendSysMessage("Unlocked transmogs for slot %u:", slot);
+
+            for (uint32 index = transmogs.Next(); index != TransmogPartMask::npos; index = transmogs.Next(index))
+                handler->PSendSysMessage("|- %u", sTransmogMgr->GetTransmogPartByIndex(index)->ID);
         }
         return true;
     }
@@ -85,14 +89,16 @@ public:
         if (!transmog)
             return false;
 
+        TransmogPartMask displayables;
+
         for (uint32 i = 0; i < EQUIPMENT_SLOT_END; ++i)
         {
-            std::set<uint32> displayables = sTransmogMgr->GetDisplayable(player, i);
+            sTransmogMgr->GetDisplayable(player, i, displayables);
 
             handler->PSendSysMessage("Unlockable and unlocked transmogs for slot %u:", i);
 
-            for (std::set<uint32>::iterator itr = displayables.begin(); itr != displayables.end(); ++itr)
-                handler->PSendSysMessage("|- %u", *itr);
+            for (uint32 index = displayables.Next(); index != TransmogPartMask::npos; index = displayables.Next(index))
+                handler->PSendSysMessage("|- %u", sTransmogMgr->GetTransmogPartByIndex(index)->ID);
         }
         return true;
     }
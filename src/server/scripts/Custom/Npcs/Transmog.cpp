@@ -68,16 +68,18 @@ const char BackToMenuName[] = {'Z', 'u', 'r', (char) 0xc3, (char) 0xbc, 'c', 'k'
 
 void GenerateSlotOverviewMenu(Player* player)
 {
-    std::set<uint32> transmogSlots = player->GetTransmog()->GetAvailableSlots();
+    uint32 transmogSlots = player->GetTransmog()->GetAvailableSlots();
     sTransmogMgr->AddUnlockableSlots(player, transmogSlots);
 
-    for (std::set<uint32>::iterator itr = transmogSlots.begin(); itr != transmogSlots.end(); ++itr)
-        player->ADD_GOSSIP_ITEM(GOSSIP_ICON_CHAT, GetSlotName(*itr), (*itr), ACTION_SLOT);
+    for (uint32 slot = 0; slot < EQUIPMENT_SLOT_END; ++slot)
+        if (transmogSlots & (1 << slot))
+            player->ADD_GOSSIP_ITEM(GOSSIP_ICON_CHAT, GetSlotName(slot), slot, ACTION_SLOT);
 }
 
 void GenerateSlotMenu(Player* player, uint32 slot)
 {
-    std::set<uint32> unlockable = sTransmogMgr->GetDisplayable(player, slot);
+    TransmogPartMask unlockable;
+    sTransmogMgr->GetDisplayable(player, slot, unlockable);
 
     PlayerTransmog *transmog = player->GetTransmog();
 
@@ -85,32 +87,32 @@ void GenerateSlotMenu(Player* player, uint32 slot)
     if (Item* pItem = player->GetItemByPos(INVENTORY_SLOT_BAG_0, slot))
         activeTransmog = transmog->GetActiveTransmog(pItem->GetGUIDLow());
 
-    for (std::set<uint32>::iterator itr = unlockable.begin(); itr != unlockable.end(); ++itr)
+    for (uint32 index = unlockable.Next(); index != TransmogPartMask::npos; index = unlockable.Next(index))
     {
-        TransmogPartEntry const* entry = sTransmogMgr->GetTransmogPartEntry(*itr);
+        TransmogPartEntry const* entry = sTransmogMgr->GetTransmogPartByIndex(index);
 
         std::stringstream ss;
         ss << entry->Name;
 
-        if (activeTransmog == *itr)
+        if (activeTransmog == entry->ID)
         {
             ss << " [aktiv]";
             player->ADD_GOSSIP_ITEM(GOSSIP_ICON_CHAT, ss.str(), slot, ACTION_SLOT);
         }
-        else if (transmog->IsUnlocked(*itr, slot))
+        else if (transmog->IsUnlocked(entry))
         {
             ss << " [gekauft]";
-            player->ADD_GOSSIP_ITEM(GOSSIP_ICON_CHAT, ss.str(), (uint32) (*itr), ACTION_SLOT_ACTIVATE);
+            player->ADD_GOSSIP_ITEM(GOSSIP_ICON_CHAT, ss.str(), entry->ID, ACTION_SLOT_ACTIVATE);
         }
-        else if (transmog->IsHistory(*itr, slot))
+        else if (transmog->IsHistory(entry))
         {
             ss << " [gesperrt]";
-            player->ADD_GOSSIP_ITEM(GOSSIP_ICON_CHAT, ss.str(), (uint32) (*itr), ACTION_SLOT_SHOW_REBUY);
+            player->ADD_GOSSIP_ITEM(GOSSIP_ICON_CHAT, ss.str(), entry->ID, ACTION_SLOT_SHOW_REBUY);
         }
         else
         {
             ss << " [erwerbbar]";
-            player->ADD_GOSSIP_ITEM(GOSSIP_ICON_CHAT, ss.str(), (uint32) (*itr), ACTION_SLOT_SHOW_UNLOCK);
+            player->ADD_GOSSIP_ITEM(GOSSIP_ICON_CHAT, ss.str(), entry->ID, ACTION_SLOT_SHOW_UNLOCK);
         }
     }
 
@@ -121,11 +123,11 @@ void GenerateSlotMenu(Player* player, uint32 slot)
 void ActivateTransmog(Player* player, uint32 transmogID)
 {
     TransmogPartEntry const* entry = sTransmogMgr->GetTransmogPartEntry(transmogID);
-    Item* pItem = player->GetItemByPos(INVENTORY_SLOT_BAG_0, sTransmogMgr->GetSlot(entry->ItemEntry));
+    Item* pItem = player->GetItemByPos(INVENTORY_SLOT_BAG_0, entry->ItemSlot);
 
     player->GetTransmog()->ActivateTransmog(pItem, transmogID);
 
-    GenerateSlotMenu(player, sTransmogMgr->GetSlot(entry->ItemEntry));
+    GenerateSlotMenu(player, entry->ItemSlot);
 }
 
 void GenerateUnlockMenu(Player* player, uint32 transmogID)
@@ -173,7 +175,7 @@ void UnlockTransmog(Player* player, uint32 costSubID)
                 player->GetTransmog()->UnlockTransmog(entry);
         }
 
-        GenerateSlotMenu(player, sTransmogMgr->GetSlot(entry->ItemEntry));
+        GenerateSlotMenu(player, entry->ItemSlot);
     }
     else
         GenerateSlotOverviewMenu(player);
@@ -217,7 +219,7 @@ void RebuyTransmog(Player* player, uint32 costSubID)
         if (TransmogCost::Pay(player, cost, costSubID))
             player->GetTransmog()->UnlockTransmog(entry);
 
-        GenerateSlotMenu(player, sTransmogMgr->GetSlot(entry->ItemEntry));
+        GenerateSlotMenu(player, entry->ItemSlot);
     }
     else
         GenerateSlotOverviewMenu(player);
@@ -237,6 +239,7 @@ void ClearTransmog(Player* player, uint32 slot)
 
 bool NpcTransmog::OnGossipHello(Player* player, Creature* creature)
 {
+    player->GetTransmog()->InvalidateConditionCache();
     GenerateSlotOverviewMenu(player);
     player->SEND_GOSSIP_MENU(player->GetGossipTextId(creature), creature->GetGUID());
     return true;
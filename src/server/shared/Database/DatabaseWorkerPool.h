@@ -337,11 +337,19 @@ class DatabaseWorkerPool
         //! return object as soon as the query is executed.
         //! The return value is then processed in ProcessQueryCallback methods.
         //! Any prepared statements added to this holder need to be prepared with the CONNECTION_ASYNC flag.
-        QueryResultHolderFuture DelayQueryHolder(SQLQueryHolder* holder)
+        //! With parallel set, the holder is split over all asynchronous connections so independent queries
+        //! (e.g. the character login queries) don't wait for each other on a single connection.
+        QueryResultHolderFuture DelayQueryHolder(SQLQueryHolder* holder, bool parallel = false)
         {
             QueryResultHolderFuture res;
-            SQLQueryHolderTask* task = new SQLQueryHolderTask(holder, res);
-            Enqueue(task);
+
+            uint32 taskCount = 1;
+            if (parallel)
+                taskCount = std::max<uint32>(1, std::min<uint32>(_connectionCount[IDX_ASYNC], holder->GetSize()));
+
+            holder->SetPendingTasks(taskCount);
+            for (uint32 i = 0; i < taskCount; ++i)
+                Enqueue(new SQLQueryHolderTask(holder, res, i, taskCount));
             return res;     //! Fool compiler, has no use yet
         }
 
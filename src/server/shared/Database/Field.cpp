@@ -27,39 +27,24 @@ Field::Field()
 
 Field::~Field()
 {
-    CleanUp();
 }
 
-void Field::SetByteValue(const void* newValue, const size_t newSize, enum_field_types newType, uint32 length)
+void Field::SetByteValue(void const* newValue, enum_field_types newType, uint32 length)
 {
-    if (data.value)
-        CleanUp();
-
-    // This value stores raw bytes that have to be explicitly casted later
-    if (newValue)
-    {
-        data.value = new char[newSize];
-        memcpy(data.value, newValue, newSize);
-        data.length = length;
-    }
+    // This value stores raw bytes that have to be explicitly casted later,
+    // the memory belongs to the PreparedResultSet arena and is not copied
+    data.value = const_cast<void*>(newValue);
+    data.length = length;
     data.type = newType;
     data.raw = true;
 }
 
-void Field::SetStructuredValue(char* newValue, enum_field_types newType)
+void Field::SetStructuredValue(char* newValue, enum_field_types newType, uint32 length)
 {
-    if (data.value)
-        CleanUp();
-
-    // This value stores somewhat structured data that needs function style casting
-    if (newValue)
-    {
-        size_t size = strlen(newValue);
-        data.value = new char [size+1];
-        strcpy((char*)data.value, newValue);
-        data.length = size;
-    }
-
+    // This value stores somewhat structured data that needs function style casting,
+    // the memory belongs to the current MYSQL_ROW of the ResultSet and is not copied
+    data.value = newValue;
+    data.length = length;
     data.type = newType;
     data.raw = false;
 }
@@ -243,7 +243,13 @@ class Field
                     string = "";
                 return std::string(string, data.length);
             }
-            return std::string((char*)data.value);
+            return std::string((char*)data.value, data.length);
+        }
+
+        // Length of string/blob data without copying it, use together with GetCString()
+        uint32 GetLength() const
+        {
+            return data.value ? data.length : 0;
         }
 
         bool _IsNumeric() const
@@ -267,8 +273,8 @@ class Field
         #endif
         struct
         {
-            uint32 length;          // Length (prepared strings only)
-            void* value;            // Actual data in memory
+            uint32 length;          // Length of string/blob data
+            void* value;            // Actual data in memory, owned by the result set
             enum_field_types type;  // Field type
             bool raw;               // Raw bytes? (Prepared statement or ad hoc)
          } data;
@@ -278,14 +284,8 @@ class Field
         #pragma pack(pop)
         #endif
 
-        void SetByteValue(void const* newValue, size_t const newSize, enum_field_types newType, uint32 length);
-        void SetStructuredValue(char* newValue, enum_field_types newType);
-
-        void CleanUp()
-        {
-            delete[] ((char*)data.value);
-            data.value = NULL;
-        }
+        void SetByteValue(void const* newValue, enum_field_types newType, uint32 length);
+        void SetStructuredValue(char* newValue, enum_field_types newType, uint32 length);
 
         static size_t SizeForType(MYSQL_FIELD* field)
         {
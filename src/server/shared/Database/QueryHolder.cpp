@@ -174,9 +174,9 @@ bool SQLQueryHolderTask::Execute()
     /// we can do this, we are friends
     std::vector<SQLQueryHolder::SQLResultPair> &queries = m_holder->m_queries;
 
-    for (size_t i = 0; i < queries.size(); i++)
+    for (size_t i = m_taskIndex; i < queries.size(); i += m_taskCount)
     {
-        /// execute all queries in the holder and pass the results
+        /// execute our share of the queries in the holder and pass the results
         if (SQLElementData* data = &queries[i].first)
         {
             switch (data->type)
@@ -199,6 +199,8 @@ bool SQLQueryHolderTask::Execute()
         }
     }
 
-    m_result.set(m_holder);
+    /// results are stored per index, so parallel tasks never touch the same slot
+    if (--m_holder->m_pendingTasks == 0)
+        m_result.set(m_holder);
     return true;
 }
@@ -19,6 +19,7 @@
 #define _QUERYHOLDER_H
 
 #include <ace/Future.h>
+#include <ace/Atomic_Op.h>
 
 class SQLQueryHolder
 {
@@ -26,8 +27,9 @@ class SQLQueryHolder
     private:
         typedef std::pair<SQLElementData, SQLResultSetUnion> SQLResultPair;
         std::vector<SQLResultPair> m_queries;
+        ACE_Atomic_Op<ACE_Thread_Mutex, uint32> m_pendingTasks;     // Tasks still executing parts of this holder
     public:
-        SQLQueryHolder() {}
+        SQLQueryHolder() : m_pendingTasks(0) {}
         ~SQLQueryHolder();
         bool SetQuery(size_t index, const char *sql);
         bool SetPQuery(size_t index, const char *format, ...) ATTR_PRINTF(3, 4);
@@ -37,19 +39,26 @@ class SQLQueryHolder
         PreparedQueryResult GetPreparedResult(size_t index);
         void SetResult(size_t index, ResultSet* result);
         void SetPreparedResult(size_t index, PreparedResultSet* result);
+        size_t GetSize() const { return m_queries.size(); }
+        void SetPendingTasks(uint32 count) { m_pendingTasks = count; }
 };
 
 typedef ACE_Future<SQLQueryHolder*> QueryResultHolderFuture;
 
+//- Executes every taskCount-th query of a holder, starting at taskIndex.
+//- A holder may be split into several tasks running on different async connections,
+//- the last task to finish sets the future.
 class SQLQueryHolderTask : public SQLOperation
 {
     private:
         SQLQueryHolder * m_holder;
         QueryResultHolderFuture m_result;
+        uint32 m_taskIndex;
+        uint32 m_taskCount;
 
     public:
-        SQLQueryHolderTask(SQLQueryHolder *holder, QueryResultHolderFuture res)
-            : m_holder(holder), m_result(res){};
+        SQLQueryHolderTask(SQLQueryHolder *holder, QueryResultHolderFuture res, uint32 taskIndex = 0, uint32 taskCount = 1)
+            : m_holder(holder), m_result(res), m_taskIndex(taskIndex), m_taskCount(taskCount) {};
         bool Execute();
 
 };
@@ -33,6 +33,10 @@ PreparedResultSet::PreparedResultSet(MYSQL_STMT* stmt, MYSQL_RES *result, uint64
 m_rowCount(rowCount),
 m_rowPosition(0),
 m_fieldCount(fieldCount),
+m_rows(NULL),
+m_rowData(NULL),
+m_rowOffsets(NULL),
+m_rowSize(0),
 m_rBind(NULL),
 m_stmt(stmt),
 m_res(result),
@@ -63,10 +67,16 @@ m_length(NULL)
         delete[] m_rBind;
         delete[] m_isNull;
         delete[] m_length;
+        m_rBind = NULL;
+        m_rowCount = 0;
         return;
     }
 
-    //- This is where we prepare the buffer based on metadata
+    //- This is where we prepare the row layout based on metadata
+    //- Every row is packed into one contiguous arena, column i lives at m_rowOffsets[i]
+    m_rowOffsets = new size_t[m_fieldCount];
+    m_rowSize = 0;
+
     uint32 i = 0;
     MYSQL_FIELD* field = mysql_fetch_field(m_res);
     while (field)
@@ -74,41 +84,54 @@ m_length(NULL)
         size_t size = Field::SizeForType(field);
 
         m_rBind[i].buffer_type = field->type;
-        m_rBind[i].buffer = malloc(size);
-        memset(m_rBind[i].buffer, 0, size);
+        m_rBind[i].buffer = NULL;
         m_rBind[i].buffer_length = size;
         m_rBind[i].length = &m_length[i];
         m_rBind[i].is_null = &m_isNull[i];
         m_rBind[i].error = NULL;
         m_rBind[i].is_unsigned = field->flags & UNSIGNED_FLAG;
 
+        //- Keep every column 8 byte aligned, Field reads the values through typed pointers
+        m_rowOffsets[i] = m_rowSize;
+        m_rowSize += (size + 7) & ~size_t(7);
+
         ++i;
         field = mysql_fetch_field(m_res);
     }
 
-    //- This is where we bind the bind the buffer to the statement
-    if (mysql_stmt_bind_result(m_stmt, m_rBind))
-    {
-        sLog->outSQLDriver("%s:mysql_stmt_bind_result, cannot bind result from MySQL server. Error: %s", __FUNCTION__, mysql_stmt_error(m_stmt));
-        delete[] m_rBind;
-        delete[] m_isNull;
-        delete[] m_length;
-        return;
-    }
-
     m_rowCount = mysql_stmt_num_rows(m_stmt);
 
-    m_rows.resize(uint32(m_rowCount));
-    while (_NextRow())
+    //- One allocation for all values and one for all field views, no per row allocations
+    m_rowData = new char[size_t(m_rowCount) * m_rowSize];
+    m_rows = new Field[size_t(m_rowCount) * m_fieldCount];
+
+    while (m_rowPosition < m_rowCount)
     {
-        m_rows[uint32(m_rowPosition)] = new Field[m_fieldCount];
-        for (uint64 fIndex = 0; fIndex < m_fieldCount; ++fIndex)
+        char* rowData = m_rowData + size_t(m_rowPosition) * m_rowSize;
+
+        //- Let mysql fetch directly into the arena instead of copying out of a scratch buffer
+        for (uint32 fIndex = 0; fIndex < m_fieldCount; ++fIndex)
+            m_rBind[fIndex].buffer = rowData + m_rowOffsets[fIndex];
+
+        //- This is where we bind the bind the buffer to the statement
+        if (mysql_stmt_bind_result(m_stmt, m_rBind))
+        {
+            sLog->outSQLDriver("%s:mysql_stmt_bind_result, cannot bind result from MySQL server. Error: %s", __FUNCTION__, mysql_stmt_error(m_stmt));
+            m_rowCount = m_rowPosition;
+            break;
+        }
+
+        if (!_NextRow())
+        {
+            m_rowCount = m_rowPosition;
+            break;
+        }
+
+        Field* row = &m_rows[size_t(m_rowPosition) * m_fieldCount];
+        for (uint32 fIndex = 0; fIndex < m_fieldCount; ++fIndex)
         {
-            if (!*m_rBind[fIndex].is_null)
-                m_rows[uint32(m_rowPosition)][fIndex].SetByteValue( m_rBind[fIndex].buffer,
-                                                            m_rBind[fIndex].buffer_length,
-                                                            m_rBind[fIndex].buffer_type,
-                                                           *m_rBind[fIndex].length );
+            if (!m_isNull[fIndex])
+                row[fIndex].SetByteValue(m_rBind[fIndex].buffer, m_rBind[fIndex].buffer_type, m_length[fIndex]);
             else
                 switch (m_rBind[fIndex].buffer_type)
                 {
@@ -118,16 +141,10 @@ m_length(NULL)
                     case MYSQL_TYPE_BLOB:
                     case MYSQL_TYPE_STRING:
                     case MYSQL_TYPE_VAR_STRING:
-                    m_rows[uint32(m_rowPosition)][fIndex].SetByteValue( "",
-                                                            m_rBind[fIndex].buffer_length,
-                                                            m_rBind[fIndex].buffer_type,
-                                                           *m_rBind[fIndex].length );
-                    break;
+                        row[fIndex].SetByteValue("", m_rBind[fIndex].buffer_type, 0);
+                        break;
                     default:
-                    m_rows[uint32(m_rowPosition)][fIndex].SetByteValue( 0,
-                                                            m_rBind[fIndex].buffer_length,
-                                                            m_rBind[fIndex].buffer_type,
-                                                           *m_rBind[fIndex].length );
+                        row[fIndex].SetByteValue(NULL, m_rBind[fIndex].buffer_type, 0);
                 }
         }
         m_rowPosition++;
@@ -145,8 +162,9 @@ ResultSet::~ResultSet()
 
 PreparedResultSet::~PreparedResultSet()
 {
-    for (uint32 i = 0; i < uint32(m_rowCount); ++i)
-        delete[] m_rows[i];
+    delete[] m_rows;
+    delete[] m_rowData;
+    delete[] m_rowOffsets;
 }
 
 bool ResultSet::NextRow()
@@ -163,8 +181,9 @@ bool ResultSet::NextRow()
         return false;
     }
 
+    unsigned long* lengths = mysql_fetch_lengths(_result);
     for (uint32 i = 0; i < _fieldCount; i++)
-        _currentRow[i].SetStructuredValue(row[i], _fields[i].type);
+        _currentRow[i].SetStructuredValue(row[i], _fields[i].type, uint32(lengths[i]));
 
     return true;
 }
@@ -218,14 +237,9 @@ void PreparedResultSet::CleanUp()
     if (m_res)
         mysql_free_result(m_res);
 
-    FreeBindBuffer();
     mysql_stmt_free_result(m_stmt);
 
+    /// Bind buffers point into m_rowData and are released with the result set
     delete[] m_rBind;
-}
-
-void PreparedResultSet::FreeBindBuffer()
-{
-    for (uint32 i = 0; i < m_fieldCount; ++i)
-        free (m_rBind[i].buffer);
+    m_rBind = NULL;
 }
@@ -76,22 +76,26 @@ class PreparedResultSet
         Field* Fetch() const
         {
             ASSERT(m_rowPosition < m_rowCount);
-            return m_rows[uint32(m_rowPosition)];
+            return &m_rows[size_t(m_rowPosition) * m_fieldCount];
         }
 
         const Field & operator [] (uint32 index) const
         {
             ASSERT(m_rowPosition < m_rowCount);
             ASSERT(index < m_fieldCount);
-            return m_rows[uint32(m_rowPosition)][index];
+            return m_rows[size_t(m_rowPosition) * m_fieldCount + index];
         }
 
     protected:
-        std::vector<Field*> m_rows;
         uint64 m_rowCount;
         uint64 m_rowPosition;
         uint32 m_fieldCount;
 
+        Field* m_rows;              // m_rowCount * m_fieldCount views into m_rowData
+        char* m_rowData;            // Packed row arena, every row is m_rowSize bytes
+        size_t* m_rowOffsets;       // Offset of each column inside a packed row
+        size_t m_rowSize;
+
     private:
         MYSQL_BIND* m_rBind;
         MYSQL_STMT* m_stmt;
@@ -100,7 +104,6 @@ class PreparedResultSet
         my_bool* m_isNull;
         unsigned long* m_length;
 
-        void FreeBindBuffer();
         void CleanUp();
         bool _NextRow();
 
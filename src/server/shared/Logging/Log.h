@@ -155,6 +155,7 @@ class Log
 
         bool IsOutDebug() const { return m_logLevel > 2 || (m_logFileLevel > 2 && logfile); }
         bool IsOutCharDump() const { return m_charLog_Dump; }
+        bool IsOutDebug(DebugLogFilters f) const { return (m_DebugLogMask & f) != 0; }
 
         bool GetLogDB() const { return m_enableLogDB; }
         bool GetLogDBLater() const { return m_enableLogDBLater; }
@@ -0,0 +1,231 @@
+/*
+ * Copyright (C) 2008-2014 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ObjectPool.h"
+#include "CompilerDefs.h"
+#include <ace/Guard_T.h>
+#include <ace/Thread_Mutex.h>
+#include <ace/TSS_T.h>
+#include <algorithm>
+#include <atomic>
+#include <new>
+#include <set>
+
+#if COMPILER == COMPILER_GNU && PLATFORM != PLATFORM_WINDOWS
+// resolved when the bundled jemalloc is linked in, NULL otherwise
+extern "C" int mallctl(char const* name, void* oldp, size_t* oldlenp, void* newp, size_t newlen) __attribute__((weak));
+#endif
+
+namespace
+{
+    size_t const POOL_GRANULARITY = 16;
+    size_t const MAX_POOLED_SIZE  = 32 * 1024;              // larger objects go straight to the heap
+    size_t const SIZE_CLASSES     = MAX_POOLED_SIZE / POOL_GRANULARITY;
+    size_t const MAX_FREE_BYTES   = 4 * 1024 * 1024;        // per block size and thread, the rest is given back to the heap
+    size_t const MIN_FREE_BLOCKS  = 64;
+
+    // only the owning thread changes a free list, GetStats reads the counters from other threads
+    struct FreeList
+    {
+        explicit FreeList(size_t blockSize) : Allocations(0), Reuses(0), Frees(0), FreeBlocks(0),
+            MaxFreeBlocks(std::max(MIN_FREE_BLOCKS, MAX_FREE_BYTES / blockSize)) { }
+
+        std::vector<void*> Blocks;
+        std::atomic<uint64> Allocations;
+        std::atomic<uint64> Reuses;
+        std::atomic<uint64> Frees;
+        std::atomic<uint32> FreeBlocks;
+        size_t MaxFreeBlocks;
+    };
+
+    // single writer, so no locked read-modify-write is needed
+    template<class T>
+    inline void Increase(std::atomic<T>& counter, T value = 1)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    struct RetiredCounters
+    {
+        uint64 Allocations;
+        uint64 Reuses;
+        uint64 Frees;
+    };
+
+    class ThreadCache;
+
+    // taken when a thread starts or stops using the pool and by GetStats, never by Allocate/Deallocate
+    ACE_Thread_Mutex RegistryLock;
+    std::set<ThreadCache*> ThreadCaches;
+    RetiredCounters Retired[SIZE_CLASSES];                  // counters of the threads that have ended
+
+    class ThreadCache
+    {
+        public:
+            ThreadCache()
+            {
+                for (size_t i = 0; i < SIZE_CLASSES; ++i)
+                    Lists[i].store(NULL, std::memory_order_relaxed);
+
+                ACE_Guard<ACE_Thread_Mutex> guard(RegistryLock);
+                ThreadCaches.insert(this);
+            }
+
+            ~ThreadCache()
+            {
+                ACE_Guard<ACE_Thread_Mutex> guard(RegistryLock);
+                ThreadCaches.erase(this);
+                for (size_t i = 0; i < SIZE_CLASSES; ++i)
+                {
+                    FreeList* freeList = Lists[i].load(std::memory_order_relaxed);
+                    if (!freeList)
+                        continue;
+
+                    Retired[i].Allocations += freeList->Allocations.load(std::memory_order_relaxed);
+                    Retired[i].Reuses += freeList->Reuses.load(std::memory_order_relaxed);
+                    Retired[i].Frees += freeList->Frees.load(std::memory_order_relaxed);
+                    for (std::vector<void*>::const_iterator itr = freeList->Blocks.begin(); itr != freeList->Blocks.end(); ++itr)
+                        ::operator delete(*itr);
+                    delete freeList;
+                }
+            }
+
+            FreeList* GetFreeList(size_t blockSize)
+            {
+                std::atomic<FreeList*>& slot = Lists[blockSize / POOL_GRANULARITY - 1];
+                FreeList* freeList = slot.load(std::memory_order_relaxed);
+                if (!freeList)
+                {
+                    freeList = new FreeList(blockSize);
+                    slot.store(freeList, std::memory_order_release);
+                }
+                return freeList;
+            }
+
+            std::atomic<FreeList*> Lists[SIZE_CLASSES];
+    };
+
+    typedef ACE_TSS<ThreadCache> ThreadCacheTSS;
+    ThreadCacheTSS threadCaches;
+}
+
+void* ObjectPool::Allocate(size_t size)
+{
+    size_t blockSize = (size + POOL_GRANULARITY - 1) / POOL_GRANULARITY * POOL_GRANULARITY;
+    if (!blockSize || blockSize > MAX_POOLED_SIZE)
+        return ::operator new(size);
+
+    FreeList* freeList = threadCaches->GetFreeList(blockSize);
+    Increase<uint64>(freeList->Allocations);
+    if (!freeList->Blocks.empty())
+    {
+        void* block = freeList->Blocks.back();
+        freeList->Blocks.pop_back();
+        freeList->FreeBlocks.store(uint32(freeList->Blocks.size()), std::memory_order_relaxed);
+        Increase<uint64>(freeList->Reuses);
+        return block;
+    }
+
+    return ::operator new(blockSize);
+}
+
+void ObjectPool::Deallocate(void* ptr, size_t size)
+{
+    if (!ptr)
+        return;
+
+    size_t blockSize = (size + POOL_GRANULARITY - 1) / POOL_GRANULARITY * POOL_GRANULARITY;
+    if (!blockSize || blockSize > MAX_POOLED_SIZE)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    // the block goes to the list of the freeing thread, whichever thread allocated it
+    FreeList* freeList = threadCaches->GetFreeList(blockSize);
+    Increase<uint64>(freeList->Frees);
+    if (freeList->Blocks.size() < freeList->MaxFreeBlocks)
+    {
+        freeList->Blocks.push_back(ptr);
+        freeList->FreeBlocks.store(uint32(freeList->Blocks.size()), std::memory_order_relaxed);
+        return;
+    }
+
+    ::operator delete(ptr);
+}
+
+void ObjectPool::GetStats(std::vector<ObjectPoolStats>& stats)
+{
+    ACE_Guard<ACE_Thread_Mutex> guard(RegistryLock);
+    for (size_t i = 0; i < SIZE_CLASSES; ++i)
+    {
+        uint64 allocations = Retired[i].Allocations;
+        uint64 reuses = Retired[i].Reuses;
+        uint64 frees = Retired[i].Frees;
+        uint32 freeBlocks = 0;
+        for (std::set<ThreadCache*>::const_iterator itr = ThreadCaches.begin(); itr != ThreadCaches.end(); ++itr)
+        {
+            FreeList* freeList = (*itr)->Lists[i].load(std::memory_order_acquire);
+            if (!freeList)
+                continue;
+
+            allocations += freeList->Allocations.load(std::memory_order_relaxed);
+            reuses += freeList->Reuses.load(std::memory_order_relaxed);
+            frees += freeList->Frees.load(std::memory_order_relaxed);
+            freeBlocks += freeList->FreeBlocks.load(std::memory_order_relaxed);
+        }
+
+        if (!allocations && !frees)
+            continue;
+
+        ObjectPoolStats entry;
+        entry.BlockSize = (i + 1) * POOL_GRANULARITY;
+        entry.Allocations = allocations;
+        entry.Reuses = reuses;
+        entry.LiveBlocks = allocations > frees ? uint32(allocations - frees) : 0;
+        entry.FreeBlocks = freeBlocks;
+        stats.push_back(entry);
+    }
+}
+
+bool ObjectPool::GetHeapStats(HeapStats& stats)
+{
+#if COMPILER == COMPILER_GNU && PLATFORM != PLATFORM_WINDOWS
+    if (!mallctl)
+        return false;
+
+    // jemalloc caches its statistics until the epoch is advanced
+    uint64_t epoch = 1;
+    size_t epochSize = sizeof(epoch);
+    mallctl("epoch", &epoch, &epochSize, &epoch, epochSize);
+
+    size_t allocated, active, mapped;
+    size_t valueSize = sizeof(size_t);
+    if (mallctl("stats.allocated", &allocated, &valueSize, NULL, 0) ||
+        mallctl("stats.active", &active, &valueSize, NULL, 0) ||
+        mallctl("stats.mapped", &mapped, &valueSize, NULL, 0))
+        return false;
+
+    stats.Allocated = allocated;
+    stats.Active = active;
+    stats.Mapped = mapped;
+    return true;
+#else
+    (void)stats;
+    return false;
+#endif
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2008-2014 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_OBJECTPOOL_H
+#define TRINITY_OBJECTPOOL_H
+
+#include "Define.h"
+#include <vector>
+
+struct ObjectPoolStats
+{
+    size_t BlockSize;
+    uint64 Allocations;
+    uint64 Reuses;                                          // allocations served from the free list
+    uint32 LiveBlocks;
+    uint32 FreeBlocks;
+};
+
+struct HeapStats
+{
+    uint64 Allocated;                                       // bytes requested by the application
+    uint64 Active;                                          // bytes in pages holding allocations
+    uint64 Mapped;                                          // bytes mapped from the system
+};
+
+/*
+ * Free lists per block size for classes that are created and destroyed all the time (creatures,
+ * game objects, spells, auras). A freed block is kept for the next object of the same size instead
+ * of going back to the heap, so long running servers do not fragment the heap with them.
+ * Every thread has its own free lists, so no lock is taken. A block freed on another thread than
+ * the one that allocated it simply goes to the list of the freeing thread.
+ */
+class ObjectPool
+{
+    public:
+        static void* Allocate(size_t size);
+        static void Deallocate(void* ptr, size_t size);
+
+        static void GetStats(std::vector<ObjectPoolStats>& stats);
+        // false when the server does not run on the bundled jemalloc or it was built without statistics
+        static bool GetHeapStats(HeapStats& stats);
+};
+
+// new and delete of the derived classes go through ObjectPool, each distinct class size gets its own free list
+class PooledObject
+{
+    public:
+        static void* operator new(size_t size) { return ObjectPool::Allocate(size); }
+        static void operator delete(void* ptr, size_t size) { ObjectPool::Deallocate(ptr, size); }
+};
+
+#endif
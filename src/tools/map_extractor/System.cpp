@@ -3,7 +3,14 @@
 #include <stdio.h>
 #include <deque>
 #include <set>
+#include <map>
+#include <vector>
+#include <string>
 #include <cstdlib>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
 
 #ifdef _WIN32
 #include "direct.h"
@@ -38,6 +45,7 @@ uint16 *LiqType;
 char output_path[128] = ".";
 char input_path[128] = ".";
 uint32 maxAreaId = 0;
+uint32 maxLiqTypeId = 0;
 
 // **************************************************
 // Extractor options
@@ -61,6 +69,9 @@ float CONF_float_to_int16_limit = 2048.0f;   // Max accuracy = val/65536
 float CONF_flat_height_delta_limit = 0.005f; // If max - min less this value - surface is flat
 float CONF_flat_liquid_delta_limit = 0.001f; // If max - min less this value - liquid surface is flat
 
+// Number of threads converting map tiles, 0 - one per cpu core
+int   CONF_threads = 0;
+
 // List MPQ for extract from
 const char *CONF_mpq_list[]={
     "common.MPQ",
@@ -105,6 +116,7 @@ void Usage(char* prg)
         "-o set output path\n"\
         "-e extract only MAP(1)/DBC(2) - standard: both(3)\n"\
         "-f height stored as int (less map size but lost some accuracy) 1 by default\n"\
+        "-t number of threads converting map tiles, one per cpu core by default\n"\
         "Example: %s -f 0 -i \"c:\\games\\game\"", prg, prg);
     exit(1);
 }
@@ -118,6 +130,7 @@ void HandleArgs(int argc, char * arg[])
         // e - extract only MAP(1)/DBC(2) - standard both(3)
         // f - use float to int conversion
         // h - limit minimum height
+        // t - number of map conversion threads
         if(arg[c][0] != '-')
             Usage(arg[0]);
 
@@ -151,6 +164,16 @@ void HandleArgs(int argc, char * arg[])
                 else
                     Usage(arg[0]);
                 break;
+            case 't':
+                if(c + 1 < argc)                            // all ok
+                {
+                    CONF_threads=atoi(arg[(c++) + 1]);
+                    if(CONF_threads < 0)
+                        Usage(arg[0]);
+                }
+                else
+                    Usage(arg[0]);
+                break;
         }
     }
 }
@@ -256,6 +279,8 @@ void ReadLiquidTypeTableDBC()
     for(uint32 x = 0; x < liqTypeCount; ++x)
         LiqType[dbc.getRecord(x).getUInt(0)] = dbc.getRecord(x).getUInt(3);
 
+    maxLiqTypeId = dbc.getMaxId();
+
     printf("Done! (%zu LiqTypes loaded)\n", liqTypeCount);
 }
 
@@ -338,33 +363,76 @@ float selectUInt16StepStore(float maxDiff)
 {
     return 65535 / maxDiff;
 }
-// Temporary grid data store
-uint16 area_flags[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
-
-float V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
-float V9[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
-uint16 uint16_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
-uint16 uint16_V9[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
-uint8  uint8_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
-uint8  uint8_V9[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
-
-uint16 liquid_entry[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
-uint8 liquid_flags[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
-bool  liquid_show[ADT_GRID_SIZE][ADT_GRID_SIZE];
-float liquid_height[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
-
-bool ConvertADT(char *filename, char *filename2, int /*cell_y*/, int /*cell_x*/, uint32 build)
+// Temporary grid data store, one per conversion thread
+thread_local uint16 area_flags[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+
+thread_local float V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local float V9[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
+thread_local uint16 uint16_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local uint16 uint16_V9[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
+thread_local uint8  uint8_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local uint8  uint8_V9[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
+
+thread_local uint16 liquid_entry[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+thread_local uint8 liquid_flags[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+thread_local bool  liquid_show[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local float liquid_height[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
+
+// libmpq keeps per archive state, only one thread may read from the MPQs at a time
+std::mutex mpqMutex;
+
+enum ConvertResult
+{
+    CONVERT_FAILED,
+    CONVERT_DONE,
+    CONVERT_UNCHANGED
+};
+
+uint64 HashBytes(uint64 hash, void const* data, size_t size)
+{
+    uint8 const* bytes = (uint8 const*)data;
+    for (size_t i = 0; i < size; ++i)
+        hash = (hash ^ bytes[i]) * 1099511628211ULL;
+    return hash;
+}
+
+// FNV-1a over the ADT data and everything else that changes the output:
+// the map format, the options, the client build and the AreaTable/LiquidType data written into the tile
+uint64 HashADT(uint8 const* data, uint32 size, uint32 build)
+{
+    uint64 hash = HashBytes(14695981039346656037ULL, data, size);
+
+    float const options[] = { float(CONF_allow_height_limit), CONF_use_minHeight, float(CONF_allow_float_to_int), CONF_float_to_int8_limit,
+        CONF_float_to_int16_limit, CONF_flat_height_delta_limit, CONF_flat_liquid_delta_limit };
+    hash = HashBytes(hash, MAP_VERSION_MAGIC, 4);
+    hash = HashBytes(hash, options, sizeof(options));
+    hash = HashBytes(hash, &build, sizeof(build));
+    hash = HashBytes(hash, areas, (maxAreaId + 1) * sizeof(uint16));
+    hash = HashBytes(hash, LiqType, (maxLiqTypeId + 1) * sizeof(uint16));
+    return hash;
+}
+
+// sourceHash holds the hash of the last conversion of this tile (0 if unknown) and receives the current one
+ConvertResult ConvertADT(char *filename, char *filename2, uint32 build, uint64& sourceHash)
 {
     ADT_file adt;
 
-    if (!adt.loadFile(filename))
-        return false;
+    {
+        std::lock_guard<std::mutex> lock(mpqMutex);
+        if (!adt.loadFile(filename))
+            return CONVERT_FAILED;
+    }
+
+    uint64 hash = HashADT(adt.GetData(), adt.GetDataSize(), build);
+    if (hash == sourceHash && FileExists(filename2))
+        return CONVERT_UNCHANGED;
+    sourceHash = hash;
 
     adt_MCIN *cells = adt.a_grid->getMCIN();
     if (!cells)
     {
         printf("Can't find cells in '%s'\n", filename);
-        return false;
+        return CONVERT_FAILED;
     }
 
     memset(liquid_show, 0, sizeof(liquid_show));
@@ -820,7 +888,7 @@ bool ConvertADT(char *filename, char *filename2, int /*cell_y*/, int /*cell_x*/,
     if(!output)
     {
         printf("Can't create the output file '%s'\n", filename2);
-        return false;
+        return CONVERT_FAILED;
     }
     fwrite(&map, sizeof(map), 1, output);
     // Store area data
@@ -866,7 +934,95 @@ bool ConvertADT(char *filename, char *filename2, int /*cell_y*/, int /*cell_x*/,
     }
     fclose(output);
 
-    return true;
+    return CONVERT_DONE;
+}
+
+struct TileJob
+{
+    std::string mpqName;
+    std::string outputName;
+    std::string tileName;
+    uint64 sourceHash;
+};
+
+typedef std::map<std::string, uint64> TileHashMap;
+
+// Source hashes of the tiles converted by the previous run, stored next to the .map files
+void LoadTileHashes(std::string const& cacheFile, TileHashMap& hashes)
+{
+    FILE* input = fopen(cacheFile.c_str(), "r");
+    if (!input)
+        return;
+
+    char name[1024];
+    unsigned long long hash;
+    while (fscanf(input, "%1023s %llx", name, &hash) == 2)
+        hashes[name] = hash;
+    fclose(input);
+}
+
+void SaveTileHashes(std::string const& cacheFile, std::vector<TileJob> const& jobs)
+{
+    FILE* output = fopen(cacheFile.c_str(), "w");
+    if (!output)
+    {
+        printf("Can't create the output file '%s'\n", cacheFile.c_str());
+        return;
+    }
+
+    for (std::vector<TileJob>::const_iterator itr = jobs.begin(); itr != jobs.end(); ++itr)
+        if (itr->sourceHash)
+            fprintf(output, "%s %016llx\n", itr->tileName.c_str(), (unsigned long long)itr->sourceHash);
+    fclose(output);
+}
+
+void ConvertTiles(std::vector<TileJob>& jobs, uint32 build)
+{
+    unsigned int threadCount = CONF_threads ? CONF_threads : std::thread::hardware_concurrency();
+    if (!threadCount)
+        threadCount = 1;
+
+    printf("Convert %u map tiles using %u threads\n", uint32(jobs.size()), threadCount);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::atomic<uint32> next(0);
+    std::atomic<uint32> done(0);
+    std::atomic<uint32> results[3];
+    for (int i = 0; i < 3; ++i)
+        results[i] = 0;
+
+    std::vector<std::thread> workers;
+    for (unsigned int i = 0; i < threadCount; ++i)
+    {
+        workers.push_back(std::thread([&]()
+        {
+            for (uint32 index = next++; index < jobs.size(); index = next++)
+            {
+                TileJob& job = jobs[index];
+                uint64 hash = job.sourceHash;
+                ConvertResult result = ConvertADT(&job.mpqName[0], &job.outputName[0], build, hash);
+                job.sourceHash = result == CONVERT_FAILED ? 0 : hash;
+                ++results[result];
+                ++done;
+            }
+        }));
+    }
+
+    // draw progress bar
+    while (done < jobs.size())
+    {
+        printf("Processing........................%u%%\r", uint32(uint64(done) * 100 / jobs.size()));
+        fflush(stdout);
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    }
+
+    for (std::vector<std::thread>::iterator itr = workers.begin(); itr != workers.end(); ++itr)
+        itr->join();
+
+    uint32 elapsed = uint32(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+    printf("Processing........................100%%\n");
+    printf("Converted %u tiles, skipped %u unchanged tiles, %u failed in %u.%03u s\n",
+        uint32(results[CONVERT_DONE]), uint32(results[CONVERT_UNCHANGED]), uint32(results[CONVERT_FAILED]), elapsed / 1000, elapsed % 1000);
 }
 
 void ExtractMapsFromMpq(uint32 build)
@@ -886,6 +1042,11 @@ void ExtractMapsFromMpq(uint32 build)
     path += "/maps/";
     CreateDir(path);
 
+    std::string cacheFile = path + "extractor.cache";
+    TileHashMap hashes;
+    LoadTileHashes(cacheFile, hashes);
+
+    std::vector<TileJob> jobs;
     printf("Convert map files\n");
     for(uint32 z = 0; z < map_count; ++z)
     {
@@ -907,13 +1068,21 @@ void ExtractMapsFromMpq(uint32 build)
                     continue;
                 sprintf(mpq_filename, "World\\Maps\\%s\\%s_%u_%u.adt", map_ids[z].name, map_ids[z].name, x, y);
                 sprintf(output_filename, "%s/maps/%03u%02u%02u.map", output_path, map_ids[z].id, y, x);
-                ConvertADT(mpq_filename, output_filename, y, x, build);
+
+                TileJob job;
+                job.mpqName = mpq_filename;
+                job.outputName = output_filename;
+                job.tileName = job.outputName.substr(job.outputName.rfind('/') + 1);
+                TileHashMap::const_iterator itr = hashes.find(job.tileName);
+                job.sourceHash = itr != hashes.end() ? itr->second : 0;
+                jobs.push_back(job);
             }
-            // draw progress bar
-            printf("Processing........................%d%%\r", (100 * (y+1)) / WDT_MAP_SIZE);
         }
     }
-    printf("\n");
+
+    ConvertTiles(jobs, build);
+    SaveTileHashes(cacheFile, jobs);
+
     delete [] areas;
     delete [] map_ids;
 }